@@ -0,0 +1,83 @@
+/*
+ * The output stage. The lcdg table gives the alpha that, blended in sRGB,
+ * comes closest to blending in linear light, so with it a channel's output
+ * is just
+ *
+ *     ac = table[fg << 8 | coverage]
+ *     out = (ac * fg + (255 - ac) * bg + 128) / 255
+ *
+ * and with both colors constant that is a function of coverage alone.
+ * Only the fg rows are needed, so they come from a lazy table built for
+ * exactly the backgrounds of the mode.
+ */
+#include <math.h>
+#include <stdint.h>
+
+#include "composite.h"
+#include "lcdglyph.h"
+
+#define COLOR_MODES 3
+
+/* Foreground and background of each channel */
+static const uint8_t mode_fg[COLOR_MODES][3] = {
+    { 0, 0, 0 },
+    { 255, 255, 255 },
+    { 255, 0, 0 },
+};
+static const uint8_t mode_bg[COLOR_MODES][3] = {
+    { 255, 255, 255 },
+    { 0, 0, 0 },
+    { 0, 255, 0 },
+};
+
+int32_t composite_init(composite_t *composite, int32_t color, int32_t linear) {
+    if (color < 0 || color >= COLOR_MODES) {
+        return -1;
+    }
+    const uint8_t *fg = mode_fg[color];
+    const uint8_t *bg = mode_bg[color];
+
+    if (linear) {
+        for (int32_t c = 0; c < 3; c += 1) {
+            for (int32_t alpha = 0; alpha < 256; alpha += 1) {
+                float a = alpha / 255.0f;
+                float mix = (fg[c] / 255.0f) * a + (1.0f - a) * (bg[c] / 255.0f);
+                composite->lut[c][alpha] = roundf(powf(mix, 1.0f/2.2f) * 255.0f);
+            }
+        }
+        return 0;
+    }
+
+    uint8_t bg_start = 255, bg_end = 0;
+    for (int32_t c = 0; c < 3; c += 1) {
+        bg_start = bg[c] < bg_start ? bg[c] : bg_start;
+        bg_end = bg[c] > bg_end ? bg[c] : bg_end;
+    }
+    lcdg_lazy_table_t *table = lcdg_lazy_table_new(bg_start, bg_end);
+    if (table == 0) {
+        return -1;
+    }
+    for (int32_t c = 0; c < 3; c += 1) {
+        const uint8_t *row = lcdg_table_row(table, fg[c]);
+        if (row == 0) {
+            lcdg_lazy_table_free(table);
+            return -1;
+        }
+        for (int32_t alpha = 0; alpha < 256; alpha += 1) {
+            /* Same rounding as lcdg_blend_span */
+            uint32_t y = row[alpha] * fg[c] + (255 - row[alpha]) * bg[c] + 129;
+            composite->lut[c][alpha] = (y + (y >> 8)) >> 8;
+        }
+    }
+    lcdg_lazy_table_free(table);
+    return 0;
+}
+
+void composite_row(const composite_t *composite, uint8_t *rgba, const uint8_t *coverage, int32_t width) {
+    for (int32_t x = 0; x < width; x += 1) {
+        rgba[x * 4 + 0] = composite->lut[0][coverage[x * 3 + 0]];
+        rgba[x * 4 + 1] = composite->lut[1][coverage[x * 3 + 1]];
+        rgba[x * 4 + 2] = composite->lut[2][coverage[x * 3 + 2]];
+        rgba[x * 4 + 3] = 0xff;
+    }
+}
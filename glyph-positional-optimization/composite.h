@@ -0,0 +1,21 @@
+#ifndef _COMPOSITE_H
+#define _COMPOSITE_H 1
+
+#include <stdint.h>
+
+/* Filtered coverage to output sRGB, one lookup table per channel. The
+ * foreground and background of each channel are fixed by the color mode,
+ * so the whole blend folds into the tables. */
+typedef struct {
+    uint8_t lut[3][256];
+} composite_t;
+
+/* Color modes: 0 black on white, 1 white on black, 2 red on green. Blends through the lcdg alpha
+ * correction table, or in linear light with gamma 2.2 if linear is set.
+ * Returns 0 on success. */
+int32_t composite_init(composite_t *composite, int32_t color, int32_t linear);
+
+/* Convert width pixels of 3 subpixel coverages each to opaque RGBA */
+void composite_row(const composite_t *composite, uint8_t *rgba, const uint8_t *coverage, int32_t width);
+
+#endif
@@ -1,218 +1,234 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <ft2build.h>
 #include <freetype/freetype.h>
-#include <freetype/ftglyph.h>
-#include <freetype/ftmodapi.h>
-#include <freetype/ftoutln.h>
-#include <math.h>
-#include <png.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "composite.h"
+#include "glyph_cache.h"
+#include "layout.h"
+#include "lcd_filter.h"
+#include "output.h"
+#include "placement.h"
+#include "probe.h"
+#include "profile.h"
 
 #define WIDTH 800
+#define GLYPH_CACHE_BUDGET (1 << 20)
+/* Rows rendered at a time, which bounds the memory of the picture */
+#define BAND_ROWS 16
+#define COLOR_MODES 3
 
-static uint8_t map(float fg, float bg, uint8_t alpha) {
-    float a = alpha / 255.0f;
-    float mix = fg * a + (1.0f - a) * bg;
-    return roundf(powf(mix, 1.0f/2.2f) * 255.0f);
-}
+static const char *default_text = "+ The quick brown fox jumps over the lazy dog. Ta To iiiillll1111|||||////\\\\\\\\";
 
-static void build_glyph(FT_Face face, int32_t glyph_index) {
-    FT_Load_Glyph(face, glyph_index, FT_LOAD_NO_AUTOHINT | FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP);
-    FT_Outline_EmboldenXY(&face->glyph->outline, 32, 32);
-}
-
-/* The analysis is only be carried out on (almost) vertical and (almost) horizontal lines.
- * Curves would be assumed to be too "curvy" and to always antialias, and therefore can be ignored.
- * The remaining lines denote the relevant edges of solid regions, and such regions are separated
- * by moveto instructions.
- *
- * 1. A line that's almost vertical or horizontal (= less than 0.5 px difference in either x or y
- *    endpoint coords) would be reduced to its midpoint to estimate location of its edge, and
- *    its length would be stored to be used as a weighting factor later. Data is
- *    (direction, 1-dimensional position, length). Line must be at least 1 px long to qualify.
- * 
- * 2. Once all vertical and horizontal edges have be collected, then the optimizer
- *    splits the edges into two separate lists based on direction for the optimal offset analysis.
- *
- * 3. The optimal offset will be most easily done by only storing the bottom 6 bits of the line
- *    midpoint coordinates and then averaging the lines by their weight, and then returning that value
- *    as the negative offset. This also gives upper limit for the datastructures involved:
- *
- * horiz lists: 64 elements
- * vert lists: 64 elements
- */
+/* Settings shared by every picture */
 typedef struct {
-    FT_Pos horiz[64];
-    FT_Pos vert[64];
-    FT_Pos x, y;
-} optimize_state_t;
-
-static int32_t optimize_move_to(const FT_Vector *to, void *data) {
-    optimize_state_t *state = data;
-    state->x = to->x;
-    state->y = to->y;
-    return 0;
-}
+    const char *font_name;
+    int32_t nthreads;
+    int32_t sample;
+    const char *profile_dir;
+    int32_t nscales;
+    int32_t joint;
+    int32_t verbose;
+    lcd_filter_t filter;
+    output_format_t format;
+    /* Indexed by color mode */
+    composite_t composite[COLOR_MODES];
+    /* Valid if use_profile, with the size filled in for each size */
+    int32_t use_profile;
+    profile_key_t key;
+} options_t;
+
+/* Alignment of the face at one size and its rendered glyphs */
+typedef struct {
+    int32_t size_in_px;
+    FT_Vector position;
+    glyph_placement_t *placements;
+    glyph_cache_t *cache;
+    layout_cache_t *layout;
+} sized_face_t;
 
-static int32_t optimize_line_to(const FT_Vector *to, void *data) {
-    optimize_state_t *state = data;
-    FT_Pos dx = to->x - state->x;
-    FT_Pos dy = to->y - state->y;
-    FT_Pos len = 0.5f + sqrtf(dx * dx + dy * dy);
-
-    if ((abs(dx) <= 32 || abs(dy) <= 32) && len >= 64) {
-        //fprintf(stderr, "Found a line from (%f, %f) to (%f, %f)\n", state->x / 64.0f, state->y / 64.0f, to->x / 64.0f, to->y / 64.0f);
-        FT_Pos cx = (to->x + state->x + 1) >> 1;
-        FT_Pos cy = (to->y + state->y + 1) >> 1;
-        int32_t is_vert = abs(dx) < abs(dy);
-        FT_Pos* list = is_vert ? state->vert : state->horiz;
-        FT_Pos idx = is_vert ? cx : cy;
-        list[idx & 0x3f] += len;
+static int32_t set_size(const options_t *options, FT_Face face, int32_t size_in_px, sized_face_t *sized) {
+    FT_Error error = FT_Set_Pixel_Sizes(face, size_in_px*3, size_in_px);
+    if (error) {
+        fprintf(stderr, "FT set pixel sizes: error %d\n", error);
+        return 1;
     }
 
-    state->x = to->x;
-    state->y = to->y;
-    return 0;
-}
-
-static int32_t optimize_conic_to(const FT_Vector *ctrl, const FT_Vector *to, void *data) {
-    optimize_state_t *state = data;
-    state->x = to->x;
-    state->y = to->y;
-    return 0;
-}
-
-static int32_t optimize_cubic_to(const FT_Vector *ctrl1, const FT_Vector *ctrl2, const FT_Vector *to, void *data) {
-    optimize_state_t *state = data;
-    state->x = to->x;
-    state->y = to->y;
-    return 0;
-}
+    /* Horizontal offset of each glyph at its natural scale, PROFILE_UNKNOWN
+     * until computed */
+    uint8_t *glyph_offsets = malloc(face->num_glyphs);
+    memset(glyph_offsets, PROFILE_UNKNOWN, face->num_glyphs);
 
-static FT_Pos optimize_middle(FT_Pos *list) {
-    FT_Pos bestedge = 0;
-    FT_Pos bestsum = 0x7fffffff;
-    for (int32_t edge = 0; edge < 64; edge += 1) {
-        int32_t sum = 0;
-        for (int32_t i = 0; i < 64; i += 1) {
-            int32_t dist = edge - i;
-            /* Pixel grid wrap: maximum distance is -32 to 31 */
-            if (dist < -32) {
-                dist += 64;
-            }
-            if (dist >= 32) {
-                dist -= 64;
-            }
-
-            /* Penalizes distance of stems relative to the current 'edge' coordinate */
-            sum += dist * dist * list[i];
-        }
-
-        /* Smallest sum gets the best expected edge distribution */
-        if (sum < bestsum) {
-            bestsum = sum;
-            bestedge = edge;
+    FT_Vector position;
+    profile_key_t key = options->key;
+    key.size_in_px = size_in_px;
+    profile_t profile;
+    if (options->use_profile && profile_open(&profile, options->profile_dir, &key, face->num_glyphs, options->sample) == 0) {
+        position = profile.offset;
+        memcpy(glyph_offsets, profile.glyph_offsets, profile.num_glyphs);
+        profile_close(&profile);
+    } else {
+        optimize_placement(face, options->font_name, size_in_px, options->nthreads, options->sample, &position, options->use_profile ? glyph_offsets : 0);
+        if (options->use_profile) {
+            profile_save(options->profile_dir, &key, &position, face->num_glyphs, glyph_offsets, options->sample);
         }
     }
+    fprintf(stderr, "Translating font face by (%ld, %ld) 1/64th pixels\n", position.x, position.y);
 
-    return bestedge;
-}
-
-static void optimize_placement(FT_Face face, FT_Vector *pos) {
-    optimize_state_t state = {};
-    FT_Outline_Funcs funcs = {
-        .move_to = optimize_move_to,
-        .line_to = optimize_line_to,
-        .conic_to = optimize_conic_to,
-        .cubic_to = optimize_cubic_to,
-        .shift = 0,
-        .delta = 0
-    };
-    for (int32_t glyph_index = 1; glyph_index < face->num_glyphs; glyph_index ++) {
-        build_glyph(face, glyph_index);
-        FT_Outline_Decompose(&face->glyph->outline, &funcs, &state);
+    /* Profiles only know the offsets of unscaled glyphs on the face's
+     * baseline; the others are searched when first used. A negative scale
+     * marks a glyph not yet placed. */
+    glyph_placement_t *placements = malloc(face->num_glyphs * sizeof(glyph_placement_t));
+    for (FT_Long i = 0; i < face->num_glyphs; i += 1) {
+        placements[i].offset.x = glyph_offsets[i];
+        placements[i].offset.y = position.y;
+        placements[i].scale = glyph_offsets[i] == PROFILE_UNKNOWN || options->nscales > 1 || options->joint ? -1 : 0;
+        placements[i].score = 0;
     }
+    free(glyph_offsets);
 
-    pos->x = optimize_middle(state.vert);
-    pos->y = optimize_middle(state.horiz);
+    sized->size_in_px = size_in_px;
+    sized->position = position;
+    sized->placements = placements;
+    sized->cache = glyph_cache_new(GLYPH_CACHE_BUDGET);
+    sized->layout = layout_cache_new(face);
+    return 0;
 }
 
-static void optimize_placement_single(FT_Outline *outline, FT_Vector *pos) {
-    optimize_state_t state = {};
-    FT_Outline_Funcs funcs = {
-        .move_to = optimize_move_to,
-        .line_to = optimize_line_to,
-        .conic_to = optimize_conic_to,
-        .cubic_to = optimize_cubic_to,
-        .shift = 0,
-        .delta = 0
-    };
-    FT_Outline_Decompose(outline, &funcs, &state);
+static void release_size(sized_face_t *sized) {
+    glyph_cache_stats_t stats;
+    glyph_cache_stats(sized->cache, &stats);
+    fprintf(stderr, "Glyph cache: %ld hits, %ld misses, %ld bytes\n", (long) stats.hits, (long) stats.misses, (long) stats.bytes);
 
-    pos->x = optimize_middle(state.vert);
-    pos->y = optimize_middle(state.horiz);
+    glyph_cache_free(sized->cache);
+    layout_cache_free(sized->layout);
+    free(sized->placements);
 }
 
-int main(int argc, char **argv) {
-    if (argc != 4) {
-        fprintf(stderr, "Usage: %s font_file size_in_px color\n", argv[0]);
-        return 1;
-    }
-
-    char *font_name = argv[1];
-    int32_t size_in_px = atoi(argv[2]);
-    int32_t color = atoi(argv[3]);
-
-    FT_Library library;
-    FT_Error error;
+static const cached_glyph_t *find_glyph(FT_Face face, sized_face_t *sized, int32_t glyph_index) {
+    const glyph_placement_t *placement = &sized->placements[glyph_index];
+    return glyph_cache_find(sized->cache, face, sized->size_in_px, glyph_index, placement->scale, placement->offset);
+}
 
-    error = FT_Init_FreeType(&library);
-    if (error) {
-        fprintf(stderr, "FT init freetype: error %d\n", error);
-        return 1;
+static const cached_glyph_t *load_glyph(FT_Face face, sized_face_t *sized, int32_t glyph_index) {
+    const glyph_placement_t *placement = &sized->placements[glyph_index];
+    FT_Vector pos2 = placement->offset;
+    const cached_glyph_t *glyph = find_glyph(face, sized, glyph_index);
+    if (!glyph) {
+        FT_Matrix matrix;
+        placement_matrix(sized->size_in_px, placement->scale, &matrix);
+        FT_Set_Transform(face, &matrix, &pos2);
+        build_glyph(face, glyph_index);
+        PROBE_START(start);
+        FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL);
+        PROBE_STOP(PROBE_RENDER, start);
+        glyph = glyph_cache_insert(sized->cache, face, sized->size_in_px, glyph_index, placement->scale, pos2, face->glyph);
     }
+    return glyph;
+}
 
-    /* Disable stem darkening; we have our own thing with bolding */
-    FT_Bool no_stem_darkening = 1;
-    FT_Property_Set(library, "cff", "no-stem-darkening", &no_stem_darkening);
-
+/* The bands of one picture. Glyphs are only ever added, and the LCD
+ * filter runs along rows, so every band can be rendered on its own and
+ * comes out the same as when the picture is rendered in one go. */
+typedef struct {
+    const options_t *options;
     FT_Face face;
-    error = FT_New_Face(library, font_name, 0, &face);
-    if (error) {
-        fprintf(stderr, "FT new face: error %d\n", error);
-        return 1;
+    sized_face_t *sized;
+    int32_t color;
+    int32_t height;
+    const placed_glyph_t *layout;
+    /* Bitmap of every laid out glyph, or 0 to load them while rendering */
+    const cached_glyph_t **bitmaps;
+    int32_t nbands;
+    /* Layout indices of the glyphs touching band b are in
+     * bins[offsets[b]] .. bins[offsets[b + 1] - 1] */
+    int32_t *offsets;
+    int32_t *bins;
+    /* Bands rendered together, and their RGBA rows */
+    int32_t group_start;
+    int32_t group_bands;
+    uint8_t *rgba;
+    int32_t next;
+} tiles_t;
+
+/* Render band b into rgba, using band for the coverage */
+static void render_band(tiles_t *tiles, int32_t b, uint16_t *band, uint8_t *rgba) {
+    int32_t band_y = b * BAND_ROWS;
+    int32_t band_rows = tiles->height - band_y < BAND_ROWS ? tiles->height - band_y : BAND_ROWS;
+
+    /* Unfiltered coverage, summed without clamping until lcd_filter_row */
+    PROBE_START(start);
+    memset(band, 0, band_rows * WIDTH * 3 * sizeof(uint16_t));
+
+    for (int32_t k = tiles->offsets[b]; k < tiles->offsets[b + 1]; k += 1) {
+        int32_t i = tiles->bins[k];
+        const placed_glyph_t *placed = &tiles->layout[i];
+        int32_t y_start = band_y - placed->y > 0 ? band_y - placed->y : 0;
+        int32_t y_end = band_y + band_rows - placed->y < placed->rows ? band_y + band_rows - placed->y : placed->rows;
+
+        const cached_glyph_t *glyph = tiles->bitmaps ? tiles->bitmaps[i] : load_glyph(tiles->face, tiles->sized, placed->glyph_index);
+        if (!glyph) {
+            /* Out of memory: leave the glyph out */
+            continue;
+        }
+        int32_t x0 = placed->x;
+        int32_t x_start = x0 < 0 ? -x0 : 0;
+        int32_t x_end = x0 + glyph->width > WIDTH * 3 ? WIDTH * 3 - x0 : glyph->width;
+        for (int32_t y = y_start; y < y_end; y ++) {
+            uint16_t *dst = band + WIDTH * 3 * (placed->y + y - band_y) + x0;
+            const uint8_t *src = glyph->buffer + y * glyph->width;
+            for (int32_t x = x_start; x < x_end; x ++) {
+                dst[x] += src[x];
+            }
+        }
+    }
+    PROBE_STOP(PROBE_RENDER, start);
+
+    uint8_t filtered[WIDTH * 3];
+    for (int32_t y = 0; y < band_rows; y += 1) {
+        PROBE_START(filter_start);
+        lcd_filter_row(&tiles->options->filter, filtered, band + y * WIDTH * 3, WIDTH * 3);
+        PROBE_STOP(PROBE_FILTER, filter_start);
+        PROBE_START(composite_start);
+        composite_row(&tiles->options->composite[tiles->color], rgba + y * WIDTH * 4, filtered, WIDTH);
+        PROBE_STOP(PROBE_COMPOSITE, composite_start);
     }
+}
 
-    error = FT_Set_Pixel_Sizes(face, size_in_px*3, size_in_px);
-    if (error) {
-        fprintf(stderr, "FT set pixel sizes: error %d\n", error);
-        return 1;
+/* Take bands of the group until there are none left */
+static void render_bands(tiles_t *tiles, uint16_t *band) {
+    int32_t k;
+    while ((k = __sync_fetch_and_add(&tiles->next, 1)) < tiles->group_bands) {
+        render_band(tiles, tiles->group_start + k, band, tiles->rgba + k * BAND_ROWS * WIDTH * 4);
     }
+}
 
-    /* FIXME:
-     *
-     * we could also add a pass that attempts to scale the glyph by
-     * 0.5 px and then retry the alignment, and use scaled variant if the
-     * score is better.
-     *
-     * The offsets are not strictly speaking separable, but a full
-     * 64x64 scan is very slow and almost always gives the same numbers.
-     */
-    FT_Vector position;
-    optimize_placement(face, &position);
-    fprintf(stderr, "Translating font face by (%ld, %ld) 1/64th pixels\n", position.x, position.y);
+static void *tile_worker(void *arg) {
+    tiles_t *tiles = arg;
+    uint16_t *band = malloc(BAND_ROWS * WIDTH * 3 * sizeof(uint16_t));
+    render_bands(tiles, band);
+    free(band);
+    return 0;
+}
 
+/* Render text in color mode color to file. Returns 0 on success. */
+static int32_t render(const options_t *options, FT_Face face, sized_face_t *sized, const char *text, int32_t color, FILE *file) {
+    int32_t size_in_px = sized->size_in_px;
     int32_t height = size_in_px * 2;
-
-    const char *text = "+ The quick brown fox jumps over the lazy dog. Ta To iiiillll1111|||||////\\\\\\\\";
     int32_t textlen = strlen(text);
-    uint8_t *picture = malloc(3 * WIDTH * height);
-    for (int32_t i = 0; i < 3 * WIDTH * height; i += 1) {
-        picture[i] = 0;
-    }
 
-    int32_t pen_x = 0;
-    int32_t pen_y = height / 2;
-    int32_t previous = 0;
+    /* Place and measure the glyphs met for the first time, then lay the
+     * text out from the tables, so that the picture can be rendered a band
+     * of rows at a time */
+    int32_t *glyphs = malloc(textlen * sizeof(int32_t));
     for (int i = 0; i < textlen; i += 1) {
         uint8_t currentchar = text[i];
 
@@ -225,92 +241,413 @@ int main(int argc, char **argv) {
         FT_Set_Transform(face, 0, &pos2);
         */
 
-        int32_t glyph_index = FT_Get_Char_Index(face, currentchar);
+        int32_t glyph_index = layout_char_index(sized->layout, currentchar);
+        glyphs[i] = glyph_index;
 
-        FT_Vector pos2 = {};
-        FT_Set_Transform(face, 0, &pos2);
-        build_glyph(face, glyph_index);
-        optimize_placement_single(&face->glyph->outline, &pos2);
-        pos2.y = position.y;
-        FT_Set_Transform(face, 0, &pos2);
-        build_glyph(face, glyph_index);
+        glyph_metrics_t *metrics = layout_metrics(sized->layout, glyph_index);
+        if (metrics->advance != LAYOUT_UNKNOWN) {
+            continue;
+        }
 
-        if (previous) {
-            FT_Vector delta;
-            FT_Get_Kerning(face, previous, glyph_index, FT_KERNING_UNFITTED, &delta);
-            pen_x += (delta.x + 32) >> 6;
+        glyph_placement_t *placement = &sized->placements[glyph_index];
+        if (placement->scale < 0) {
+            optimize_glyph(face, glyph_index, size_in_px, options->joint ? -1 : sized->position.y, options->nscales, placement, options->verbose ? stderr : 0);
         }
-        previous = glyph_index;
+        const cached_glyph_t *glyph = load_glyph(face, sized, glyph_index);
+        if (!glyph) {
+            fprintf(stderr, "Out of memory for glyph %d\n", glyph_index);
+            free(glyphs);
+            return 1;
+        }
+        metrics->advance = glyph->advance;
+        metrics->left = glyph->left;
+        metrics->top = glyph->top;
+        metrics->rows = glyph->rows;
+    }
 
-        FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL);
-        FT_Bitmap bitmap = face->glyph->bitmap;
-        for (int32_t y = 0; y < bitmap.rows; y ++) {
-            int32_t pos_y = y + pen_y - face->glyph->bitmap_top;
-            if (pos_y < 0 || pos_y >= height) {
-                continue;
+    placed_glyph_t *layout = malloc(textlen * sizeof(placed_glyph_t));
+    layout_run(sized->layout, glyphs, textlen, height / 2, layout);
+    free(glyphs);
+
+    tiles_t tiles = {
+        .options = options,
+        .face = face,
+        .sized = sized,
+        .color = color,
+        .height = height,
+        .layout = layout,
+        .nbands = (height + BAND_ROWS - 1) / BAND_ROWS,
+    };
+
+    /* Bin the glyphs by the bands they touch */
+    tiles.offsets = calloc(tiles.nbands + 1, sizeof(int32_t));
+    for (int32_t pass = 0; pass < 2; pass += 1) {
+        for (int32_t i = 0; i < textlen; i += 1) {
+            int32_t first = layout[i].y < 0 ? 0 : layout[i].y / BAND_ROWS;
+            int32_t last = layout[i].y + layout[i].rows > height ? tiles.nbands : (layout[i].y + layout[i].rows + BAND_ROWS - 1) / BAND_ROWS;
+            for (int32_t b = first; b < last; b += 1) {
+                if (pass == 0) {
+                    tiles.offsets[b + 1] += 1;
+                } else {
+                    tiles.bins[tiles.offsets[b] ++] = i;
+                }
             }
+        }
+        if (pass == 0) {
+            for (int32_t b = 0; b < tiles.nbands; b += 1) {
+                tiles.offsets[b + 1] += tiles.offsets[b];
+            }
+            tiles.bins = malloc((tiles.offsets[tiles.nbands] + 1) * sizeof(int32_t));
+        } else {
+            /* Filling moved every offset to the start of the next band */
+            memmove(tiles.offsets + 1, tiles.offsets, tiles.nbands * sizeof(int32_t));
+            tiles.offsets[0] = 0;
+        }
+    }
 
-            for (int32_t x = 0; x < bitmap.width; x ++) {
-                int32_t c = bitmap.buffer[y * bitmap.pitch + x];
- 
-                int32_t fir[5] = { 0x0, 0x55, 0x55, 0x55, 0x0 };
-                for (int32_t dx = -2; dx <= 2; dx ++) {
-                    int32_t pos_x = dx + x + pen_x + face->glyph->bitmap_left;
-                    if (pos_x < 0 || pos_x >= WIDTH * 3) {
-                        continue;
-                    }
-
-                    int32_t x = picture[pos_x + WIDTH * 3 * pos_y];
-                    x += (c * fir[dx+2] + 128) >> 8;
-                    if (x > 255) {
-                        //fprintf(stderr, "overflow at (%d, %d)\n", pos_x, pos_y);
-                        x = 255;
-                    }
-                    picture[pos_x + WIDTH * 3 * pos_y] = x;
+    /* Threads can share the bitmaps only if they all stay in the cache at
+     * once, since the cache may move them on insert */
+    int32_t nworkers = options->nthreads < tiles.nbands ? options->nthreads : tiles.nbands;
+    if (nworkers > 1) {
+        for (int32_t i = 0; i < textlen; i += 1) {
+            if (!load_glyph(face, sized, layout[i].glyph_index)) {
+                break;
+            }
+        }
+        tiles.bitmaps = malloc(textlen * sizeof(cached_glyph_t *));
+        for (int32_t i = 0; i < textlen && tiles.bitmaps; i += 1) {
+            tiles.bitmaps[i] = find_glyph(face, sized, layout[i].glyph_index);
+            if (!tiles.bitmaps[i]) {
+                free(tiles.bitmaps);
+                tiles.bitmaps = 0;
+            }
+        }
+    }
+    if (!tiles.bitmaps) {
+        nworkers = 1;
+    }
+
+    /* Bands are rendered a group at a time and written in order, which
+     * bounds the memory to the group */
+    int32_t group = nworkers * 2 < tiles.nbands ? nworkers * 2 : tiles.nbands;
+    tiles.rgba = malloc(group * BAND_ROWS * WIDTH * 4);
+    uint16_t *band = malloc(BAND_ROWS * WIDTH * 3 * sizeof(uint16_t));
+    output_t *output = output_open(file, options->format, WIDTH, height);
+    for (int32_t start = 0; start < tiles.nbands; start += group) {
+        tiles.group_start = start;
+        tiles.group_bands = tiles.nbands - start < group ? tiles.nbands - start : group;
+        tiles.next = 0;
+
+        pthread_t threads[nworkers];
+        int32_t started = 0;
+        for (int32_t i = 1; i < nworkers; i += 1) {
+            if (pthread_create(&threads[started], 0, tile_worker, &tiles) == 0) {
+                started += 1;
+            }
+        }
+        render_bands(&tiles, band);
+        for (int32_t i = 0; i < started; i += 1) {
+            pthread_join(threads[i], 0);
+        }
+
+        int32_t rows = (start + tiles.group_bands) * BAND_ROWS > height ? height - start * BAND_ROWS : tiles.group_bands * BAND_ROWS;
+        PROBE_START(encode_start);
+        for (int32_t y = 0; y < rows; y += 1) {
+            output_row(output, tiles.rgba + y * WIDTH * 4);
+        }
+        PROBE_STOP(PROBE_ENCODE, encode_start);
+    }
+
+    free(band);
+    free(tiles.rgba);
+    free(tiles.bitmaps);
+    free(tiles.bins);
+    free(tiles.offsets);
+    free(layout);
+    PROBE_START(close_start);
+    int32_t error = output_close(output);
+    PROBE_STOP(PROBE_ENCODE, close_start);
+    return error;
+}
+
+/* Every combination of sizes, colors and texts, the sizes shared out
+ * between the workers. Each worker loads the face once. */
+typedef struct {
+    const options_t *options;
+    const char *pattern;
+    const int32_t *sizes;
+    int32_t nsizes;
+    const int32_t *colors;
+    int32_t ncolors;
+    char **texts;
+    int32_t ntexts;
+    int32_t next;
+    int32_t failed;
+} batch_t;
+
+/* Expand %s to the size, %c to the color mode and %t to the text number */
+static void output_name(char *name, size_t length, const char *pattern, int32_t size_in_px, int32_t color, int32_t text) {
+    size_t n = 0;
+    for (const char *p = pattern; *p && n + 12 < length; p ++) {
+        if (*p != '%' || p[1] == '\0') {
+            name[n ++] = *p;
+            continue;
+        }
+        p ++;
+        switch (*p) {
+        case 's':
+            n += sprintf(name + n, "%d", size_in_px);
+            break;
+        case 'c':
+            n += sprintf(name + n, "%d", color);
+            break;
+        case 't':
+            n += sprintf(name + n, "%d", text);
+            break;
+        default:
+            name[n ++] = *p;
+            break;
+        }
+    }
+    name[n] = '\0';
+}
+
+static void *batch_worker(void *arg) {
+    batch_t *batch = arg;
+    const options_t *options = batch->options;
+
+    FT_Library library;
+    FT_Face face;
+    if (open_face(options->font_name, 0, batch->sizes[0], &library, &face)) {
+        __atomic_store_n(&batch->failed, 1, __ATOMIC_RELAXED);
+        return 0;
+    }
+
+    int32_t k;
+    while ((k = __sync_fetch_and_add(&batch->next, 1)) < batch->nsizes) {
+        sized_face_t sized;
+        if (set_size(options, face, batch->sizes[k], &sized)) {
+            __atomic_store_n(&batch->failed, 1, __ATOMIC_RELAXED);
+            continue;
+        }
+        for (int32_t c = 0; c < batch->ncolors; c += 1) {
+            for (int32_t t = 0; t < batch->ntexts; t += 1) {
+                char name[4096];
+                output_name(name, sizeof(name), batch->pattern, batch->sizes[k], batch->colors[c], t);
+                FILE *file = fopen(name, "wb");
+                if (file == 0) {
+                    fprintf(stderr, "Could not open %s\n", name);
+                    __atomic_store_n(&batch->failed, 1, __ATOMIC_RELAXED);
+                    continue;
+                }
+                int32_t error = render(options, face, &sized, batch->texts[t], batch->colors[c], file);
+                if (fclose(file) != 0 || error) {
+                    fprintf(stderr, "Could not write %s\n", name);
+                    __atomic_store_n(&batch->failed, 1, __ATOMIC_RELAXED);
                 }
             }
         }
+        release_size(&sized);
+    }
 
-        pen_x += (face->glyph->advance.x + 32) >> 6;
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return 0;
+}
+
+/* Comma separated numbers. Returns their count, or -1 if malformed. */
+static int32_t parse_list(const char *arg, int32_t **values) {
+    int32_t count = 1;
+    for (const char *p = arg; *p; p ++) {
+        count += *p == ',';
+    }
+    *values = malloc(count * sizeof(int32_t));
+    const char *p = arg;
+    for (int32_t i = 0; i < count; i += 1) {
+        char *end;
+        (*values)[i] = strtol(p, &end, 10);
+        if (end == p || (*end != ',' && *end != '\0')) {
+            free(*values);
+            return -1;
+        }
+        p = end + 1;
     }
+    return count;
+}
 
-    png_structp png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-    png_infop info_ptr = png_create_info_struct(png_ptr);
-    png_init_io(png_ptr, stdout);
-    
-    png_set_IHDR(png_ptr, info_ptr, WIDTH, height,
-                 8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE,
-                 PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
-
-    png_set_sRGB(png_ptr, info_ptr, PNG_sRGB_INTENT_SATURATION);
-
-    png_write_info(png_ptr, info_ptr);
-
-    png_bytep *row_pointers = (png_bytep *) malloc(sizeof(png_bytep) * height);
-    for (int32_t y = 0; y < height; y += 1) {
-        row_pointers[y] = (png_byte *) malloc(png_get_rowbytes(png_ptr, info_ptr));
-        for (int32_t x = 0; x < WIDTH; x += 1) {
-            switch (color) {
-            case 0:
-                row_pointers[y][x*4+0] = map(0, 1, picture[y * WIDTH * 3 + x*3+0]);
-                row_pointers[y][x*4+1] = map(0, 1, picture[y * WIDTH * 3 + x*3+1]);
-                row_pointers[y][x*4+2] = map(0, 1, picture[y * WIDTH * 3 + x*3+2]);
-                break;
-            case 1:
-                row_pointers[y][x*4+0] = map(1, 0, picture[y * WIDTH * 3 + x*3+0]);
-                row_pointers[y][x*4+1] = map(1, 0, picture[y * WIDTH * 3 + x*3+1]);
-                row_pointers[y][x*4+2] = map(1, 0, picture[y * WIDTH * 3 + x*3+2]);
-                break;
-            case 2:
-                row_pointers[y][x*4+0] = map(1, 0, picture[y * WIDTH * 3 + x*3+0]);
-                row_pointers[y][x*4+1] = map(0, 1, picture[y * WIDTH * 3 + x*3+1]);
-                row_pointers[y][x*4+2] = 0;
-                break;
+/* Long options, mapped to values outside the short ones */
+enum {
+    OPTION_STATS = 256,
+};
+
+static const struct option long_options[] = {
+    { "stats", no_argument, 0, OPTION_STATS },
+    { 0, 0, 0, 0 },
+};
+
+int main(int argc, char **argv) {
+    struct timespec wall_start;
+    clock_gettime(CLOCK_MONOTONIC, &wall_start);
+
+    options_t options = {};
+    options.nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+    options.nscales = 1;
+    options.filter = lcd_filter_light;
+    options.format = OUTPUT_PNG;
+    int32_t linear = 0;
+    const char *pattern = 0;
+    int32_t nworkers = 1;
+    char **texts = malloc(argc * sizeof(char *));
+    int32_t ntexts = 0;
+    int32_t usage = 0;
+    int32_t stats = 0;
+    int opt;
+    while ((opt = getopt_long(argc, argv, "j:sp:SJvf:Go:O:P:t:", long_options, 0)) != -1) {
+        switch (opt) {
+        case 'j':
+            options.nthreads = atoi(optarg);
+            break;
+        case 's':
+            options.sample = 1;
+            break;
+        case 'p':
+            options.profile_dir = optarg;
+            break;
+        case 'S':
+            options.nscales = PLACEMENT_SCALES;
+            break;
+        case 'J':
+            options.joint = 1;
+            break;
+        case 'v':
+            options.verbose = 1;
+            break;
+        case 'f':
+            if (lcd_filter_parse(&options.filter, optarg)) {
+                usage = 1;
+            }
+            break;
+        case 'G':
+            linear = 1;
+            break;
+        case 'o':
+            if (output_parse_format(&options.format, optarg)) {
+                usage = 1;
+            }
+            break;
+        case 'O':
+            pattern = optarg;
+            break;
+        case 'P':
+            nworkers = atoi(optarg);
+            break;
+        case 't':
+            texts[ntexts ++] = optarg;
+            break;
+        case OPTION_STATS:
+            stats = 1;
+            break;
+        default:
+            usage = 1;
+            break;
+        }
+    }
+    if (ntexts == 0) {
+        texts[ntexts ++] = (char *) default_text;
+    }
+
+    int32_t *sizes = 0, *colors = 0;
+    int32_t nsizes = 0, ncolors = 0;
+    if (!usage && argc - optind == 3) {
+        nsizes = parse_list(argv[optind + 1], &sizes);
+        ncolors = parse_list(argv[optind + 2], &colors);
+    }
+    if (usage || argc - optind != 3 || nsizes < 0 || ncolors < 0
+        || (!pattern && (nsizes != 1 || ncolors != 1 || ntexts != 1))) {
+        fprintf(stderr, "Usage: %s [options] font_file size_in_px color\n", argv[0]);
+        fprintf(stderr, "       %s [options] -O pattern font_file size,... color,...\n", argv[0]);
+        fprintf(stderr, "  -j  threads for the face scan and rendering (default: one per CPU)\n");
+        fprintf(stderr, "  -s  stop the face scan early once the offsets settle\n");
+        fprintf(stderr, "  -p  load alignment profiles from and save them to profile_dir\n");
+        fprintf(stderr, "  -S  also try each glyph grown and shrunk by half a pixel\n");
+        fprintf(stderr, "  -J  align each glyph vertically too, not just the whole face\n");
+        fprintf(stderr, "  -v  print the score of every glyph candidate\n");
+        fprintf(stderr, "  -f  LCD filter: light (default), default or 5 weights a,b,c,d,e in 1/256ths\n");
+        fprintf(stderr, "  -G  blend in linear light with gamma 2.2 instead of with the lcdg table\n");
+        fprintf(stderr, "  -o  write the image as png (default), pam or raw RGBA\n");
+        fprintf(stderr, "  -t  text to render, repeated for several (batch only)\n");
+        fprintf(stderr, "  -O  render every size, color and text into files named by pattern, with\n");
+        fprintf(stderr, "      %%s the size, %%c the color and %%t the text number\n");
+        fprintf(stderr, "  -P  render that many sizes in parallel (batch only, default: 1)\n");
+        fprintf(stderr, "  --stats  print the time spent in each phase when done\n");
+        fprintf(stderr, "  color 0: black on white, 1: white on black, 2: red on green\n");
+        return 1;
+    }
+    options.font_name = argv[optind];
+    if (stats && probe_enable()) {
+        fprintf(stderr, "Built with NO_PROBES, only the wall time is known\n");
+    }
+
+    for (int32_t c = 0; c < ncolors; c += 1) {
+        if (colors[c] < 0 || colors[c] >= COLOR_MODES
+            || composite_init(&options.composite[colors[c]], colors[c], linear)) {
+            fprintf(stderr, "Unknown color mode %d\n", colors[c]);
+            return 1;
+        }
+    }
+
+    /* Hashing the font is the costly part of the key, so do it once */
+    options.use_profile = options.profile_dir && profile_key(&options.key, options.font_name, 0, sizes[0]) == 0;
+
+    int32_t failed = 0;
+    if (pattern) {
+        batch_t batch = {
+            &options, pattern, sizes, nsizes, colors, ncolors, texts, ntexts, 0, 0,
+        };
+        if (nworkers > nsizes) {
+            nworkers = nsizes;
+        }
+        pthread_t threads[nworkers > 1 ? nworkers : 1];
+        int32_t started = 0;
+        for (int32_t i = 1; i < nworkers; i += 1) {
+            if (pthread_create(&threads[started], 0, batch_worker, &batch) == 0) {
+                started += 1;
             }
-            row_pointers[y][x*4+3] = 0xff;
         }
+        batch_worker(&batch);
+        for (int32_t i = 0; i < started; i += 1) {
+            pthread_join(threads[i], 0);
+        }
+        failed = batch.failed;
+    } else {
+        FT_Library library;
+        FT_Face face;
+        if (open_face(options.font_name, 0, sizes[0], &library, &face)) {
+            return 1;
+        }
+
+        sized_face_t sized;
+        failed = set_size(&options, face, sizes[0], &sized);
+        if (!failed) {
+            failed = render(&options, face, &sized, texts[0], colors[0], stdout);
+            if (failed) {
+                fprintf(stderr, "Could not write the image\n");
+            }
+            release_size(&sized);
+        }
+
+        FT_Done_Face(face);
+        FT_Done_FreeType(library);
+    }
+
+    if (stats) {
+        struct timespec wall_end;
+        clock_gettime(CLOCK_MONOTONIC, &wall_end);
+        probe_report(stderr, (wall_end.tv_sec - wall_start.tv_sec) + (wall_end.tv_nsec - wall_start.tv_nsec) / 1e9);
     }
 
-    png_write_image(png_ptr, row_pointers);
-    png_write_end(png_ptr, NULL);
+    free(sizes);
+    free(colors);
+    free(texts);
+    return failed ? 1 : 0;
 }
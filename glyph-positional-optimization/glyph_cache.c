@@ -0,0 +1,205 @@
+/*
+ * Cache of rendered glyph bitmaps. The bitmaps live in one arena of the
+ * budget size, allocated from its end. When the next bitmap doesn't fit,
+ * least recently used glyphs are evicted until the live ones plus the new
+ * one fit the budget, and the live bitmaps are slid down to the start of
+ * the arena to make the free space contiguous again. A bitmap larger than
+ * the whole budget grows the budget by its size.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glyph_cache.h"
+
+#define BUCKETS 1024
+
+typedef struct entry {
+    cached_glyph_t glyph;
+    FT_Face face;
+    int32_t size;
+    int32_t glyph_index;
+    int32_t scale;
+    FT_Vector phase;
+    size_t offset;
+    size_t length;
+    struct entry *chain;
+    /* Most recently used first */
+    struct entry *prev;
+    struct entry *next;
+} entry_t;
+
+struct glyph_cache {
+    uint8_t *arena;
+    size_t budget;
+    size_t end;
+    size_t live;
+    int32_t count;
+    entry_t *buckets[BUCKETS];
+    entry_t *head;
+    entry_t *tail;
+    glyph_cache_stats_t stats;
+};
+
+static uint32_t hash(FT_Face face, int32_t size, int32_t glyph_index, int32_t scale, FT_Vector phase) {
+    uint32_t h = (uint32_t) (uintptr_t) face * 2654435761u;
+    h = (h ^ size) * 2654435761u;
+    h = (h ^ glyph_index) * 2654435761u;
+    h = (h ^ scale) * 2654435761u;
+    h = (h ^ (uint32_t) phase.x) * 2654435761u;
+    h = (h ^ (uint32_t) phase.y) * 2654435761u;
+    return h >> 22;
+}
+
+static void unlink_lru(glyph_cache_t *cache, entry_t *e) {
+    if (e->prev) {
+        e->prev->next = e->next;
+    } else {
+        cache->head = e->next;
+    }
+    if (e->next) {
+        e->next->prev = e->prev;
+    } else {
+        cache->tail = e->prev;
+    }
+}
+
+static void push_lru(glyph_cache_t *cache, entry_t *e) {
+    e->prev = 0;
+    e->next = cache->head;
+    if (cache->head) {
+        cache->head->prev = e;
+    } else {
+        cache->tail = e;
+    }
+    cache->head = e;
+}
+
+static void evict(glyph_cache_t *cache, entry_t *e) {
+    entry_t **link = &cache->buckets[hash(e->face, e->size, e->glyph_index, e->scale, e->phase)];
+    while (*link != e) {
+        link = &(*link)->chain;
+    }
+    *link = e->chain;
+    unlink_lru(cache, e);
+    cache->live -= e->length;
+    cache->count -= 1;
+    cache->stats.evictions += 1;
+    free(e);
+}
+
+static int compare_offset(const void *a, const void *b) {
+    const entry_t *x = *(entry_t * const *) a;
+    const entry_t *y = *(entry_t * const *) b;
+    return x->offset < y->offset ? -1 : x->offset > y->offset;
+}
+
+/* Slide the live bitmaps down to the start of arena, which is either the
+ * cache's own or a larger one replacing it */
+static void compact(glyph_cache_t *cache, uint8_t *arena) {
+    entry_t **entries = malloc(sizeof(entry_t *) * (cache->count + 1));
+    int32_t n = 0;
+    for (entry_t *e = cache->head; e; e = e->next) {
+        entries[n++] = e;
+    }
+    qsort(entries, n, sizeof(entry_t *), compare_offset);
+
+    size_t end = 0;
+    for (int32_t i = 0; i < n; i += 1) {
+        entry_t *e = entries[i];
+        memmove(arena + end, cache->arena + e->offset, e->length);
+        e->offset = end;
+        e->glyph.buffer = arena + end;
+        end += e->length;
+    }
+    cache->end = end;
+    free(entries);
+}
+
+glyph_cache_t *glyph_cache_new(size_t budget) {
+    glyph_cache_t *cache = calloc(1, sizeof(glyph_cache_t));
+    cache->arena = malloc(budget);
+    cache->budget = budget;
+    return cache;
+}
+
+const cached_glyph_t *glyph_cache_find(glyph_cache_t *cache, FT_Face face, int32_t size, int32_t glyph_index, int32_t scale, FT_Vector phase) {
+    for (entry_t *e = cache->buckets[hash(face, size, glyph_index, scale, phase)]; e; e = e->chain) {
+        if (e->face == face && e->size == size && e->glyph_index == glyph_index
+            && e->scale == scale && e->phase.x == phase.x && e->phase.y == phase.y) {
+            unlink_lru(cache, e);
+            push_lru(cache, e);
+            cache->stats.hits += 1;
+            return &e->glyph;
+        }
+    }
+    cache->stats.misses += 1;
+    return 0;
+}
+
+const cached_glyph_t *glyph_cache_insert(glyph_cache_t *cache, FT_Face face, int32_t size, int32_t glyph_index, int32_t scale, FT_Vector phase, FT_GlyphSlot slot) {
+    FT_Bitmap *bitmap = &slot->bitmap;
+    int32_t width = bitmap->width;
+    size_t length = (size_t) width * bitmap->rows;
+    if (length > cache->budget) {
+        uint8_t *arena = malloc(cache->budget + length);
+        if (!arena) {
+            return 0;
+        }
+        compact(cache, arena);
+        free(cache->arena);
+        cache->arena = arena;
+        cache->budget += length;
+    }
+
+    if (cache->end + length > cache->budget) {
+        while (cache->live + length > cache->budget) {
+            evict(cache, cache->tail);
+        }
+        compact(cache, cache->arena);
+    }
+
+    entry_t *e = calloc(1, sizeof(entry_t));
+    if (!e) {
+        return 0;
+    }
+    e->face = face;
+    e->size = size;
+    e->glyph_index = glyph_index;
+    e->scale = scale;
+    e->phase = phase;
+    e->offset = cache->end;
+    e->length = length;
+    e->glyph.left = slot->bitmap_left;
+    e->glyph.top = slot->bitmap_top;
+    e->glyph.width = width;
+    e->glyph.rows = bitmap->rows;
+    e->glyph.advance = slot->advance.x;
+    e->glyph.buffer = cache->arena + e->offset;
+
+    for (int32_t y = 0; y < bitmap->rows; y += 1) {
+        memcpy(e->glyph.buffer + y * width, bitmap->buffer + y * bitmap->pitch, width);
+    }
+
+    uint32_t h = hash(face, size, glyph_index, scale, phase);
+    e->chain = cache->buckets[h];
+    cache->buckets[h] = e;
+    push_lru(cache, e);
+    cache->end += length;
+    cache->live += length;
+    cache->count += 1;
+    return &e->glyph;
+}
+
+void glyph_cache_stats(const glyph_cache_t *cache, glyph_cache_stats_t *stats) {
+    *stats = cache->stats;
+    stats->bytes = cache->live;
+}
+
+void glyph_cache_free(glyph_cache_t *cache) {
+    while (cache->head) {
+        evict(cache, cache->head);
+    }
+    free(cache->arena);
+    free(cache);
+}
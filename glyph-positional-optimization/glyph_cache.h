@@ -0,0 +1,42 @@
+#ifndef _GLYPH_CACHE_H
+#define _GLYPH_CACHE_H 1
+
+#include <ft2build.h>
+#include <freetype/freetype.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Rendered glyph coverage, before the LCD filter. Columns are subpixels,
+ * and left is the subpixel column of the first one relative to the pen. */
+typedef struct {
+    int32_t left;
+    int32_t top;
+    int32_t width;
+    int32_t rows;
+    FT_Pos advance;
+    uint8_t *buffer;
+} cached_glyph_t;
+
+typedef struct glyph_cache glyph_cache_t;
+
+typedef struct {
+    int64_t hits;
+    int64_t misses;
+    int64_t evictions;
+    size_t bytes;
+} glyph_cache_stats_t;
+
+glyph_cache_t *glyph_cache_new(size_t budget);
+
+/* Glyphs are keyed by face, pixel size, glyph index, the scale candidate
+ * and the subpixel phase the outline was translated by. Returned glyphs
+ * stay valid until the next insert. */
+const cached_glyph_t *glyph_cache_find(glyph_cache_t *cache, FT_Face face, int32_t size, int32_t glyph_index, int32_t scale, FT_Vector phase);
+
+/* Store the bitmap rendered into slot. Returns 0 if out of memory. */
+const cached_glyph_t *glyph_cache_insert(glyph_cache_t *cache, FT_Face face, int32_t size, int32_t glyph_index, int32_t scale, FT_Vector phase, FT_GlyphSlot slot);
+
+void glyph_cache_stats(const glyph_cache_t *cache, glyph_cache_stats_t *stats);
+void glyph_cache_free(glyph_cache_t *cache);
+
+#endif
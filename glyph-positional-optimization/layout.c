@@ -0,0 +1,140 @@
+/*
+ * Text layout from tables. Character to glyph mapping for the BMP is read
+ * out of the face once, glyph metrics are stored when the glyph is first
+ * rendered, and kerning is looked up in FreeType once per pair and kept
+ * in an open addressing hash. After the first run over some text, laying
+ * out more of it doesn't call FreeType at all.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "layout.h"
+
+#define BMP 0x10000
+
+typedef struct {
+    uint64_t pair;
+    FT_Pos kerning;
+} kerning_t;
+
+/* Never a pair of glyph indices */
+#define EMPTY_PAIR UINT64_MAX
+
+struct layout_cache {
+    FT_Face face;
+    int32_t has_kerning;
+    uint16_t cmap[BMP];
+    glyph_metrics_t *metrics;
+    kerning_t *pairs;
+    /* Power of two */
+    uint32_t capacity;
+    uint32_t count;
+};
+
+static uint32_t hash(uint64_t pair) {
+    pair *= 0x9e3779b97f4a7c15ull;
+    return pair >> 32;
+}
+
+static kerning_t *find_slot(kerning_t *pairs, uint32_t capacity, uint64_t pair) {
+    uint32_t i = hash(pair) & (capacity - 1);
+    while (pairs[i].pair != pair && pairs[i].pair != EMPTY_PAIR) {
+        i = (i + 1) & (capacity - 1);
+    }
+    return &pairs[i];
+}
+
+static void reserve(layout_cache_t *cache, uint32_t capacity) {
+    kerning_t *pairs = malloc(capacity * sizeof(kerning_t));
+    for (uint32_t i = 0; i < capacity; i += 1) {
+        pairs[i].pair = EMPTY_PAIR;
+    }
+    for (uint32_t i = 0; i < cache->capacity; i += 1) {
+        if (cache->pairs[i].pair != EMPTY_PAIR) {
+            *find_slot(pairs, capacity, cache->pairs[i].pair) = cache->pairs[i];
+        }
+    }
+    free(cache->pairs);
+    cache->pairs = pairs;
+    cache->capacity = capacity;
+}
+
+static FT_Pos kerning(layout_cache_t *cache, int32_t left, int32_t right) {
+    if (!cache->has_kerning) {
+        return 0;
+    }
+
+    uint64_t pair = (uint64_t) left << 32 | (uint32_t) right;
+    kerning_t *slot = find_slot(cache->pairs, cache->capacity, pair);
+    if (slot->pair == EMPTY_PAIR) {
+        /* Keep the load at most a half */
+        if ((cache->count + 1) * 2 > cache->capacity) {
+            reserve(cache, cache->capacity * 2);
+            slot = find_slot(cache->pairs, cache->capacity, pair);
+        }
+        FT_Vector delta;
+        FT_Get_Kerning(cache->face, left, right, FT_KERNING_UNFITTED, &delta);
+        slot->pair = pair;
+        slot->kerning = delta.x;
+        cache->count += 1;
+    }
+    return slot->kerning;
+}
+
+layout_cache_t *layout_cache_new(FT_Face face) {
+    layout_cache_t *cache = calloc(1, sizeof(layout_cache_t));
+    cache->face = face;
+    cache->has_kerning = FT_HAS_KERNING(face);
+
+    FT_UInt glyph_index;
+    FT_ULong charcode = FT_Get_First_Char(face, &glyph_index);
+    while (glyph_index != 0 && charcode < BMP) {
+        cache->cmap[charcode] = glyph_index;
+        charcode = FT_Get_Next_Char(face, charcode, &glyph_index);
+    }
+
+    cache->metrics = malloc(face->num_glyphs * sizeof(glyph_metrics_t));
+    for (FT_Long i = 0; i < face->num_glyphs; i += 1) {
+        cache->metrics[i].advance = LAYOUT_UNKNOWN;
+    }
+    reserve(cache, 256);
+    return cache;
+}
+
+int32_t layout_char_index(const layout_cache_t *cache, FT_ULong charcode) {
+    if (charcode < BMP) {
+        return cache->cmap[charcode];
+    }
+    return FT_Get_Char_Index(cache->face, charcode);
+}
+
+glyph_metrics_t *layout_metrics(layout_cache_t *cache, int32_t glyph_index) {
+    return &cache->metrics[glyph_index];
+}
+
+void layout_run(layout_cache_t *cache, const int32_t *glyphs, int32_t count, int32_t pen_y, placed_glyph_t *placed) {
+    int32_t pen_x = 0;
+    int32_t previous = 0;
+    for (int32_t i = 0; i < count; i += 1) {
+        int32_t glyph_index = glyphs[i];
+        const glyph_metrics_t *metrics = &cache->metrics[glyph_index];
+
+        if (previous) {
+            pen_x += (kerning(cache, previous, glyph_index) + 32) >> 6;
+        }
+        previous = glyph_index;
+
+        placed[i].glyph_index = glyph_index;
+        placed[i].x = pen_x + metrics->left;
+        placed[i].y = pen_y - metrics->top;
+        placed[i].rows = metrics->rows;
+
+        pen_x += (metrics->advance + 32) >> 6;
+    }
+}
+
+void layout_cache_free(layout_cache_t *cache) {
+    free(cache->pairs);
+    free(cache->metrics);
+    free(cache);
+}
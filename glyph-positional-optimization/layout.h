@@ -0,0 +1,45 @@
+#ifndef _LAYOUT_H
+#define _LAYOUT_H 1
+
+#include <ft2build.h>
+#include <freetype/freetype.h>
+#include <stdint.h>
+
+/* Advance of a glyph not measured yet */
+#define LAYOUT_UNKNOWN (-1)
+
+/* What layout needs of a rendered glyph, in subpixel columns and rows */
+typedef struct {
+    FT_Pos advance;
+    int32_t left;
+    int32_t top;
+    int32_t rows;
+} glyph_metrics_t;
+
+/* Glyph of the laid out text. x is the subpixel column and y the row of
+ * the top left corner of its bitmap. */
+typedef struct {
+    int32_t glyph_index;
+    int32_t x;
+    int32_t y;
+    int32_t rows;
+} placed_glyph_t;
+
+typedef struct layout_cache layout_cache_t;
+
+/* Character map of face for the BMP, and room for the metrics of every
+ * glyph and the kerning of every pair at the face's current size */
+layout_cache_t *layout_cache_new(FT_Face face);
+
+int32_t layout_char_index(const layout_cache_t *cache, FT_ULong charcode);
+
+/* Advance LAYOUT_UNKNOWN until set by the caller */
+glyph_metrics_t *layout_metrics(layout_cache_t *cache, int32_t glyph_index);
+
+/* Place count measured glyphs on the baseline pen_y, starting from
+ * column 0 */
+void layout_run(layout_cache_t *cache, const int32_t *glyphs, int32_t count, int32_t pen_y, placed_glyph_t *placed);
+
+void layout_cache_free(layout_cache_t *cache);
+
+#endif
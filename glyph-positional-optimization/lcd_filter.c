@@ -0,0 +1,140 @@
+/*
+ * LCD filter over rows of accumulated coverage. Glyphs are added to a
+ * 16-bit canvas unfiltered and unclamped, and the filter runs once over
+ * every canvas row, so overlapping glyphs keep all of their energy and
+ * the result is saturated only when it goes down to 8 bits.
+ *
+ * Coverage sums can exceed 15 bits, so the products are formed as 32-bit
+ * values from the low and high halves of the 16-bit multiply. Packing to
+ * 16 and then 8 bits with saturation is the single clamp.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <string.h>
+
+#include "lcd_filter.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+const lcd_filter_t lcd_filter_default = { { 0x08, 0x4d, 0x56, 0x4d, 0x08 } };
+const lcd_filter_t lcd_filter_light = { { 0x00, 0x55, 0x56, 0x55, 0x00 } };
+
+int32_t lcd_filter_parse(lcd_filter_t *filter, const char *spec) {
+    if (strcmp(spec, "default") == 0) {
+        *filter = lcd_filter_default;
+        return 0;
+    }
+    if (strcmp(spec, "light") == 0) {
+        *filter = lcd_filter_light;
+        return 0;
+    }
+
+    unsigned int taps[5];
+    int end = 0;
+    if (sscanf(spec, "%u,%u,%u,%u,%u%n", &taps[0], &taps[1], &taps[2], &taps[3], &taps[4], &end) != 5
+        || spec[end] != '\0') {
+        return -1;
+    }
+    for (int32_t t = 0; t < 5; t += 1) {
+        if (taps[t] > 255) {
+            return -1;
+        }
+        filter->taps[t] = taps[t];
+    }
+    return 0;
+}
+
+static void filter_scalar(const lcd_filter_t *filter, uint8_t *dst, const uint16_t *src, int32_t start, int32_t end, int32_t width) {
+    for (int32_t x = start; x < end; x += 1) {
+        uint32_t sum = 128;
+        for (int32_t t = 0; t < 5; t += 1) {
+            int32_t i = x + t - 2;
+            if (i >= 0 && i < width) {
+                sum += (uint32_t) filter->taps[t] * src[i];
+            }
+        }
+        sum >>= 8;
+        dst[x] = sum > 255 ? 255 : sum;
+    }
+}
+
+#ifdef HAVE_X86
+__attribute__((target("sse2")))
+static int32_t filter_sse2(const lcd_filter_t *filter, uint8_t *dst, const uint16_t *src, int32_t x, int32_t width) {
+    __m128i taps[5];
+    for (int32_t t = 0; t < 5; t += 1) {
+        taps[t] = _mm_set1_epi16(filter->taps[t]);
+    }
+
+    for (; x + 16 + 2 <= width; x += 16) {
+        __m128i sum[4];
+        for (int32_t h = 0; h < 4; h += 1) {
+            sum[h] = _mm_set1_epi32(128);
+        }
+        for (int32_t t = 0; t < 5; t += 1) {
+            for (int32_t half = 0; half < 2; half += 1) {
+                __m128i c = _mm_loadu_si128((const __m128i *) (src + x + t - 2 + half * 8));
+                __m128i lo = _mm_mullo_epi16(c, taps[t]);
+                __m128i hi = _mm_mulhi_epu16(c, taps[t]);
+                sum[half * 2 + 0] = _mm_add_epi32(sum[half * 2 + 0], _mm_unpacklo_epi16(lo, hi));
+                sum[half * 2 + 1] = _mm_add_epi32(sum[half * 2 + 1], _mm_unpackhi_epi16(lo, hi));
+            }
+        }
+        __m128i a = _mm_packs_epi32(_mm_srli_epi32(sum[0], 8), _mm_srli_epi32(sum[1], 8));
+        __m128i b = _mm_packs_epi32(_mm_srli_epi32(sum[2], 8), _mm_srli_epi32(sum[3], 8));
+        _mm_storeu_si128((__m128i *) (dst + x), _mm_packus_epi16(a, b));
+    }
+
+    return x;
+}
+
+__attribute__((target("avx2")))
+static int32_t filter_avx2(const lcd_filter_t *filter, uint8_t *dst, const uint16_t *src, int32_t x, int32_t width) {
+    __m256i taps[5];
+    for (int32_t t = 0; t < 5; t += 1) {
+        taps[t] = _mm256_set1_epi16(filter->taps[t]);
+    }
+
+    for (; x + 32 + 2 <= width; x += 32) {
+        __m256i sum[4];
+        for (int32_t h = 0; h < 4; h += 1) {
+            sum[h] = _mm256_set1_epi32(128);
+        }
+        for (int32_t t = 0; t < 5; t += 1) {
+            for (int32_t half = 0; half < 2; half += 1) {
+                __m256i c = _mm256_loadu_si256((const __m256i *) (src + x + t - 2 + half * 16));
+                __m256i lo = _mm256_mullo_epi16(c, taps[t]);
+                __m256i hi = _mm256_mulhi_epu16(c, taps[t]);
+                sum[half * 2 + 0] = _mm256_add_epi32(sum[half * 2 + 0], _mm256_unpacklo_epi16(lo, hi));
+                sum[half * 2 + 1] = _mm256_add_epi32(sum[half * 2 + 1], _mm256_unpackhi_epi16(lo, hi));
+            }
+        }
+        /* unpack and pack both work within 128-bit lanes, so they cancel
+         * out for each half, and the permute puts the halves in order */
+        __m256i a = _mm256_packs_epi32(_mm256_srli_epi32(sum[0], 8), _mm256_srli_epi32(sum[1], 8));
+        __m256i b = _mm256_packs_epi32(_mm256_srli_epi32(sum[2], 8), _mm256_srli_epi32(sum[3], 8));
+        __m256i bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xd8);
+        _mm256_storeu_si256((__m256i *) (dst + x), bytes);
+    }
+
+    return filter_sse2(filter, dst, src, x, width);
+}
+#endif
+
+void lcd_filter_row(const lcd_filter_t *filter, uint8_t *dst, const uint16_t *src, int32_t width) {
+    /* The vector loops only cover columns with all taps inside the row */
+    int32_t x = width < 2 ? width : 2;
+    filter_scalar(filter, dst, src, 0, x, width);
+#ifdef HAVE_X86
+    if (__builtin_cpu_supports("avx2")) {
+        x = filter_avx2(filter, dst, src, x, width);
+    } else if (__builtin_cpu_supports("sse2")) {
+        x = filter_sse2(filter, dst, src, x, width);
+    }
+#endif
+    filter_scalar(filter, dst, src, x, width, width);
+}
@@ -0,0 +1,27 @@
+#ifndef _LCD_FILTER_H
+#define _LCD_FILTER_H 1
+
+#include <stdint.h>
+
+/* Weights of the 5 taps in 1/256ths, each below 256. Weights summing to
+ * 256 keep full coverage at 255. */
+typedef struct {
+    uint16_t taps[5];
+} lcd_filter_t;
+
+/* FreeType's FT_LCD_FILTER_DEFAULT and FT_LCD_FILTER_LIGHT */
+extern const lcd_filter_t lcd_filter_default;
+extern const lcd_filter_t lcd_filter_light;
+
+/* Parse "default", "light" or 5 comma separated weights. Returns 0
+ * on success. */
+int32_t lcd_filter_parse(lcd_filter_t *filter, const char *spec);
+
+/* Filter a row of accumulated subpixel coverage to 8 bits:
+ *
+ *     dst[x] = min(255, (sum of taps[t] * src[x + t - 2] + 128) >> 8)
+ *
+ * with src zero outside of 0 .. width - 1. */
+void lcd_filter_row(const lcd_filter_t *filter, uint8_t *dst, const uint16_t *src, int32_t width);
+
+#endif
@@ -0,0 +1,80 @@
+/*
+ * Image sinks taking one row at a time, so that the picture never has to
+ * exist in full. PNG goes through png_write_row; PAM and raw RGBA need no
+ * encoding at all, for consumers that just want the pixels.
+ */
+#include <png.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "output.h"
+
+struct output {
+    FILE *file;
+    output_format_t format;
+    int32_t width;
+    png_structp png_ptr;
+    png_infop info_ptr;
+};
+
+int32_t output_parse_format(output_format_t *format, const char *name) {
+    if (strcmp(name, "png") == 0) {
+        *format = OUTPUT_PNG;
+    } else if (strcmp(name, "pam") == 0) {
+        *format = OUTPUT_PAM;
+    } else if (strcmp(name, "raw") == 0) {
+        *format = OUTPUT_RAW;
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+output_t *output_open(FILE *file, output_format_t format, int32_t width, int32_t height) {
+    output_t *output = calloc(1, sizeof(output_t));
+    output->file = file;
+    output->format = format;
+    output->width = width;
+
+    switch (format) {
+    case OUTPUT_PNG:
+        output->png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+        output->info_ptr = png_create_info_struct(output->png_ptr);
+        png_init_io(output->png_ptr, file);
+
+        png_set_IHDR(output->png_ptr, output->info_ptr, width, height,
+                     8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE,
+                     PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
+
+        png_set_sRGB(output->png_ptr, output->info_ptr, PNG_sRGB_INTENT_SATURATION);
+
+        png_write_info(output->png_ptr, output->info_ptr);
+        break;
+    case OUTPUT_PAM:
+        fprintf(file, "P7\nWIDTH %d\nHEIGHT %d\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n", width, height);
+        break;
+    case OUTPUT_RAW:
+        break;
+    }
+    return output;
+}
+
+void output_row(output_t *output, const uint8_t *rgba) {
+    if (output->format == OUTPUT_PNG) {
+        png_write_row(output->png_ptr, (png_const_bytep) rgba);
+    } else {
+        fwrite(rgba, 4, output->width, output->file);
+    }
+}
+
+int32_t output_close(output_t *output) {
+    if (output->format == OUTPUT_PNG) {
+        png_write_end(output->png_ptr, NULL);
+        png_destroy_write_struct(&output->png_ptr, &output->info_ptr);
+    }
+    int32_t error = fflush(output->file) != 0 || ferror(output->file);
+    free(output);
+    return error ? -1 : 0;
+}
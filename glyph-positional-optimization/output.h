@@ -0,0 +1,27 @@
+#ifndef _OUTPUT_H
+#define _OUTPUT_H 1
+
+#include <stdint.h>
+#include <stdio.h>
+
+/* Sinks for RGBA rows, written as they come */
+typedef enum {
+    OUTPUT_PNG,
+    OUTPUT_PAM,
+    OUTPUT_RAW,
+} output_format_t;
+
+typedef struct output output_t;
+
+/* Parse "png", "pam" or "raw". Returns 0 on success. */
+int32_t output_parse_format(output_format_t *format, const char *name);
+
+output_t *output_open(FILE *file, output_format_t format, int32_t width, int32_t height);
+
+/* Write the next row of width RGBA pixels */
+void output_row(output_t *output, const uint8_t *rgba);
+
+/* Finish the image after all rows. Returns 0 if everything was written. */
+int32_t output_close(output_t *output);
+
+#endif
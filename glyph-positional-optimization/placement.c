@@ -0,0 +1,377 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <ft2build.h>
+#include <freetype/freetype.h>
+#include <freetype/ftglyph.h>
+#include <freetype/ftmodapi.h>
+#include <freetype/ftoutln.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "placement.h"
+#include "probe.h"
+
+int32_t open_face(const char *font_name, FT_Long face_index, int32_t size_in_px, FT_Library *library, FT_Face *face) {
+    FT_Error error;
+
+    error = FT_Init_FreeType(library);
+    if (error) {
+        fprintf(stderr, "FT init freetype: error %d\n", error);
+        return 1;
+    }
+
+    /* Disable stem darkening; we have our own thing with bolding */
+    FT_Bool no_stem_darkening = 1;
+    FT_Property_Set(*library, "cff", "no-stem-darkening", &no_stem_darkening);
+
+    error = FT_New_Face(*library, font_name, face_index, face);
+    if (error) {
+        fprintf(stderr, "FT new face: error %d\n", error);
+        FT_Done_FreeType(*library);
+        return 1;
+    }
+
+    error = FT_Set_Pixel_Sizes(*face, size_in_px*3, size_in_px);
+    if (error) {
+        fprintf(stderr, "FT set pixel sizes: error %d\n", error);
+        FT_Done_Face(*face);
+        FT_Done_FreeType(*library);
+        return 1;
+    }
+    return 0;
+}
+
+void build_glyph(FT_Face face, int32_t glyph_index) {
+    PROBE_START(start);
+    FT_Load_Glyph(face, glyph_index, FT_LOAD_NO_AUTOHINT | FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP);
+    FT_Outline_EmboldenXY(&face->glyph->outline, EMBOLDEN, EMBOLDEN);
+    PROBE_STOP(PROBE_LOAD, start);
+}
+
+/* The analysis is only be carried out on (almost) vertical and (almost) horizontal lines.
+ * Curves would be assumed to be too "curvy" and to always antialias, and therefore can be ignored.
+ * The remaining lines denote the relevant edges of solid regions, and such regions are separated
+ * by moveto instructions.
+ *
+ * 1. A line that's almost vertical or horizontal (= less than 0.5 px difference in either x or y
+ *    endpoint coords) would be reduced to its midpoint to estimate location of its edge, and
+ *    its length would be stored to be used as a weighting factor later. Data is
+ *    (direction, 1-dimensional position, length). Line must be at least 1 px long to qualify.
+ * 
+ * 2. Once all vertical and horizontal edges have be collected, then the optimizer
+ *    splits the edges into two separate lists based on direction for the optimal offset analysis.
+ *
+ * 3. The optimal offset will be most easily done by only storing the bottom 6 bits of the line
+ *    midpoint coordinates and then averaging the lines by their weight, and then returning that value
+ *    as the negative offset. This also gives upper limit for the datastructures involved:
+ *
+ * horiz lists: 64 elements
+ * vert lists: 64 elements
+ */
+typedef struct {
+    FT_Pos horiz[64];
+    FT_Pos vert[64];
+    FT_Pos x, y;
+} optimize_state_t;
+
+static int32_t optimize_move_to(const FT_Vector *to, void *data) {
+    optimize_state_t *state = data;
+    state->x = to->x;
+    state->y = to->y;
+    return 0;
+}
+
+static int32_t optimize_line_to(const FT_Vector *to, void *data) {
+    optimize_state_t *state = data;
+    FT_Pos dx = to->x - state->x;
+    FT_Pos dy = to->y - state->y;
+    FT_Pos len = 0.5f + sqrtf(dx * dx + dy * dy);
+
+    if ((abs(dx) <= 32 || abs(dy) <= 32) && len >= 64) {
+        //fprintf(stderr, "Found a line from (%f, %f) to (%f, %f)\n", state->x / 64.0f, state->y / 64.0f, to->x / 64.0f, to->y / 64.0f);
+        FT_Pos cx = (to->x + state->x + 1) >> 1;
+        FT_Pos cy = (to->y + state->y + 1) >> 1;
+        int32_t is_vert = abs(dx) < abs(dy);
+        FT_Pos* list = is_vert ? state->vert : state->horiz;
+        FT_Pos idx = is_vert ? cx : cy;
+        list[idx & 0x3f] += len;
+    }
+
+    state->x = to->x;
+    state->y = to->y;
+    return 0;
+}
+
+static int32_t optimize_conic_to(const FT_Vector *ctrl, const FT_Vector *to, void *data) {
+    optimize_state_t *state = data;
+    state->x = to->x;
+    state->y = to->y;
+    return 0;
+}
+
+static int32_t optimize_cubic_to(const FT_Vector *ctrl1, const FT_Vector *ctrl2, const FT_Vector *to, void *data) {
+    optimize_state_t *state = data;
+    state->x = to->x;
+    state->y = to->y;
+    return 0;
+}
+
+/* Weighted sum of squared distances of the edges in list to every edge
+ * position, with the pixel grid wrapping distances to -32 .. 31. Moving
+ * the edge by one grows every distance by one except the one that wraps
+ * from 31 to -32, and both of those square to 1024, so with M the weighted
+ * sum of distances and W the total weight
+ *
+ *     S(e + 1) = S(e) + 2 M(e) + W
+ *     M(e + 1) = M(e) + W - 64 list[(e + 33) & 63]
+ *
+ * and all 64 sums take O(64) instead of O(64 * 64). */
+static int64_t circular_scores(const FT_Pos *list, int64_t *scores) {
+    int64_t sum = 0;
+    int64_t moment = 0;
+    int64_t weight = 0;
+    for (int32_t i = 0; i < 64; i += 1) {
+        int32_t dist = ((32 - i) & 63) - 32;
+        sum += (int64_t) dist * dist * list[i];
+        moment += (int64_t) dist * list[i];
+        weight += list[i];
+    }
+    for (int32_t edge = 0; edge < 64; edge += 1) {
+        scores[edge] = sum;
+        sum += 2 * moment + weight;
+        moment += weight - 64 * list[(edge + 33) & 63];
+    }
+    return weight;
+}
+
+static FT_Pos best_edge(const int64_t *scores) {
+    /* Smallest sum gets the best expected edge distribution */
+    FT_Pos bestedge = 0;
+    for (int32_t edge = 1; edge < 64; edge += 1) {
+        if (scores[edge] < scores[bestedge]) {
+            bestedge = edge;
+        }
+    }
+    return bestedge;
+}
+
+static FT_Pos optimize_middle(const FT_Pos *list) {
+    int64_t scores[64];
+    circular_scores(list, scores);
+    return best_edge(scores);
+}
+
+static const FT_Outline_Funcs optimize_funcs = {
+    .move_to = optimize_move_to,
+    .line_to = optimize_line_to,
+    .conic_to = optimize_conic_to,
+    .cubic_to = optimize_cubic_to,
+    .shift = 0,
+    .delta = 0
+};
+
+static void decompose(FT_Outline *outline, optimize_state_t *state) {
+    PROBE_START(start);
+    FT_Outline_Decompose(outline, &optimize_funcs, state);
+    PROBE_STOP(PROBE_DECOMPOSE, start);
+}
+
+/* The face is scanned in batches of glyphs handed out from a shared
+ * counter. Each batch is collected into a private histogram and added to
+ * the shared one, and integer sums don't depend on the order, so any
+ * number of threads gives the same offsets as a serial scan.
+ *
+ * When sampling, the glyphs are visited with a stride coprime to their
+ * count, which spreads every prefix of the scan over the whole face, and
+ * the scan stops once the offsets haven't changed for SAMPLE_STABLE
+ * batches in a row. */
+#define BATCH 64
+#define SAMPLE_STABLE 16
+
+typedef struct {
+    const char *font_name;
+    FT_Long face_index;
+    int32_t size_in_px;
+    int32_t sample;
+    uint8_t *glyph_offsets;
+    FT_Long count;
+    FT_Long stride;
+    FT_Long next;
+    int32_t stop;
+    int32_t stable;
+    FT_Vector offset;
+    optimize_state_t state;
+    pthread_mutex_t lock;
+} scan_t;
+
+static void scan_face(scan_t *scan, FT_Face face) {
+    FT_Long batch;
+    while (!__atomic_load_n(&scan->stop, __ATOMIC_RELAXED)
+           && (batch = __sync_fetch_and_add(&scan->next, BATCH)) < scan->count) {
+        optimize_state_t state = {};
+        for (FT_Long k = batch; k < batch + BATCH && k < scan->count; k ++) {
+            FT_Long glyph_index = 1 + k * scan->stride % scan->count;
+            build_glyph(face, glyph_index);
+            if (!scan->glyph_offsets) {
+                decompose(&face->glyph->outline, &state);
+                continue;
+            }
+
+            /* Same as optimize_placement_single on the untranslated glyph */
+            optimize_state_t glyph = {};
+            decompose(&face->glyph->outline, &glyph);
+            scan->glyph_offsets[glyph_index] = optimize_middle(glyph.vert);
+            for (int32_t i = 0; i < 64; i ++) {
+                state.horiz[i] += glyph.horiz[i];
+                state.vert[i] += glyph.vert[i];
+            }
+        }
+
+        pthread_mutex_lock(&scan->lock);
+        for (int32_t i = 0; i < 64; i ++) {
+            scan->state.horiz[i] += state.horiz[i];
+            scan->state.vert[i] += state.vert[i];
+        }
+        if (scan->sample) {
+            FT_Vector offset = { optimize_middle(scan->state.vert), optimize_middle(scan->state.horiz) };
+            if (offset.x == scan->offset.x && offset.y == scan->offset.y) {
+                scan->stable ++;
+            } else {
+                scan->stable = 0;
+                scan->offset = offset;
+            }
+            if (scan->stable >= SAMPLE_STABLE) {
+                __atomic_store_n(&scan->stop, 1, __ATOMIC_RELAXED);
+            }
+        }
+        pthread_mutex_unlock(&scan->lock);
+    }
+}
+
+static void *scan_worker(void *data) {
+    scan_t *scan = data;
+    FT_Library library;
+    FT_Face face;
+    if (open_face(scan->font_name, scan->face_index, scan->size_in_px, &library, &face) == 0) {
+        scan_face(scan, face);
+        FT_Done_Face(face);
+        FT_Done_FreeType(library);
+    }
+    return 0;
+}
+
+static FT_Long coprime_stride(FT_Long count) {
+    /* About the golden ratio of the count, for an even spread */
+    FT_Long stride = count * 0.618 + 1;
+    while (stride > 1) {
+        FT_Long a = count, b = stride;
+        while (b) {
+            FT_Long t = a % b;
+            a = b;
+            b = t;
+        }
+        if (a == 1) {
+            break;
+        }
+        stride --;
+    }
+    return stride;
+}
+
+void optimize_placement(FT_Face face, const char *font_name, int32_t size_in_px, int32_t nthreads, int32_t sample, FT_Vector *pos, uint8_t *glyph_offsets) {
+    scan_t scan = {
+        .font_name = font_name,
+        .face_index = face->face_index,
+        .size_in_px = size_in_px,
+        .sample = sample,
+        .glyph_offsets = glyph_offsets,
+        .count = face->num_glyphs - 1,
+        .stride = 1,
+        .offset = { -1, -1 }
+    };
+    PROBE_START(start);
+    if (sample && scan.count > 0) {
+        scan.stride = coprime_stride(scan.count);
+    }
+    pthread_mutex_init(&scan.lock, 0);
+
+    /* FreeType objects can't be shared between threads, so every helper
+     * opens the font for itself. The calling thread works on face, which
+     * may still carry the transform of an earlier render. */
+    FT_Set_Transform(face, 0, 0);
+    if (nthreads > 256) {
+        nthreads = 256;
+    }
+    pthread_t threads[256];
+    int32_t started = 0;
+    for (int32_t i = 1; i < nthreads && (i - 1) * BATCH < scan.count; i ++) {
+        if (pthread_create(&threads[started], 0, scan_worker, &scan) == 0) {
+            started ++;
+        }
+    }
+    scan_face(&scan, face);
+    for (int32_t i = 0; i < started; i ++) {
+        pthread_join(threads[i], 0);
+    }
+    pthread_mutex_destroy(&scan.lock);
+
+    pos->x = optimize_middle(scan.state.vert);
+    pos->y = optimize_middle(scan.state.horiz);
+    PROBE_STOP(PROBE_OPTIMIZE, start);
+}
+
+void optimize_placement_single(FT_Outline *outline, FT_Vector *pos) {
+    optimize_state_t state = {};
+    decompose(outline, &state);
+
+    pos->x = optimize_middle(state.vert);
+    pos->y = optimize_middle(state.horiz);
+}
+
+/* Grow or shrink the glyph by half a pixel */
+static const int32_t placement_scales[PLACEMENT_SCALES] = { 0, 32, -32 };
+
+void placement_matrix(int32_t size_in_px, int32_t scale, FT_Matrix *matrix) {
+    FT_Fixed factor = FT_DivFix(size_in_px * 64 + placement_scales[scale], size_in_px * 64);
+    matrix->xx = factor;
+    matrix->xy = 0;
+    matrix->yx = 0;
+    matrix->yy = factor;
+}
+
+/* The score is separable: every edge counts on one axis only, so the best
+ * joint offset of the 64 x 64 grid is the best offset of each axis, and
+ * scanning the grid would only find the same pair. What costs is loading
+ * the outline, once per scale. */
+void optimize_glyph(FT_Face face, int32_t glyph_index, int32_t size_in_px, FT_Pos face_y, int32_t nscales, glyph_placement_t *placement, FILE *report) {
+    PROBE_START(start);
+    for (int32_t scale = 0; scale < nscales; scale += 1) {
+        FT_Matrix matrix;
+        placement_matrix(size_in_px, scale, &matrix);
+        FT_Set_Transform(face, &matrix, 0);
+        build_glyph(face, glyph_index);
+
+        optimize_state_t state = {};
+        decompose(&face->glyph->outline, &state);
+        int64_t xscores[64], yscores[64];
+        int64_t weight = circular_scores(state.vert, xscores) + circular_scores(state.horiz, yscores);
+        FT_Vector offset = { best_edge(xscores), face_y < 0 ? best_edge(yscores) : face_y };
+
+        /* Mean squared distance of the edges from the grid, in pixels */
+        double score = weight ? (xscores[offset.x] + yscores[offset.y]) / (double) weight / 4096.0 : 0;
+        if (report) {
+            fprintf(report, "Glyph %d scale %+.1f px: offset (%ld, %ld) score %.4f\n",
+                    glyph_index, placement_scales[scale] / 64.0, offset.x, offset.y, score);
+        }
+        if (scale == 0 || score < placement->score) {
+            placement->offset = offset;
+            placement->scale = scale;
+            placement->score = score;
+        }
+    }
+    FT_Set_Transform(face, 0, 0);
+    PROBE_STOP(PROBE_OPTIMIZE, start);
+}
@@ -0,0 +1,45 @@
+#ifndef _PLACEMENT_H
+#define _PLACEMENT_H 1
+
+#include <ft2build.h>
+#include <freetype/freetype.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* Emboldening of the outlines in 1/64 px */
+#define EMBOLDEN 32
+
+/* Open face_index of font_name in a library of its own, set up for the
+ * aligner at size_in_px. Returns 0 on success. */
+int32_t open_face(const char *font_name, FT_Long face_index, int32_t size_in_px, FT_Library *library, FT_Face *face);
+
+/* Load glyph_index into the glyph slot as an emboldened outline */
+void build_glyph(FT_Face face, int32_t glyph_index);
+
+/* Offset in 1/64 px that best aligns the stems of the whole face, scanned
+ * on nthreads threads. With sample, stop once the offsets settle. If
+ * glyph_offsets is given, the horizontal offset of optimize_placement_single
+ * is stored in it for every glyph scanned. */
+void optimize_placement(FT_Face face, const char *font_name, int32_t size_in_px, int32_t nthreads, int32_t sample, FT_Vector *pos, uint8_t *glyph_offsets);
+
+/* Same for a single outline */
+void optimize_placement_single(FT_Outline *outline, FT_Vector *pos);
+
+/* Candidate scales of optimize_glyph, the first one being unscaled */
+#define PLACEMENT_SCALES 3
+
+typedef struct {
+    FT_Vector offset;
+    int32_t scale;
+    double score;
+} glyph_placement_t;
+
+/* Transform of scale candidate scale */
+void placement_matrix(int32_t size_in_px, int32_t scale, FT_Matrix *matrix);
+
+/* Best offset of glyph_index at the first nscales scales, with the vertical
+ * offset fixed to face_y unless it is negative. Every candidate and its
+ * score is printed to report if given. Resets the transform of face. */
+void optimize_glyph(FT_Face face, int32_t glyph_index, int32_t size_in_px, FT_Pos face_y, int32_t nscales, glyph_placement_t *placement, FILE *report);
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * Phase timers. Each phase sums the time and calls of every thread with
+ * atomic adds, so the totals are CPU time rather than wall time once
+ * several threads work on a phase. Every thread keeps the total time of
+ * the probes it has finished, which is what a probe around them takes
+ * out of its own time. A thread waiting for others, as optimize does for
+ * its scan helpers, counts the wait.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "probe.h"
+
+#ifndef NO_PROBES
+static const char *phase_names[PROBE_PHASES] = {
+    "load", "decompose", "optimize", "render", "filter", "composite", "encode",
+};
+
+int32_t probe_enabled;
+
+static int64_t phase_ns[PROBE_PHASES];
+static int64_t phase_calls[PROBE_PHASES];
+
+static __thread int64_t finished_ns;
+
+static int64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+probe_t probe_start(void) {
+    probe_t probe = { now_ns(), finished_ns };
+    return probe;
+}
+
+void probe_stop(probe_phase_t phase, probe_t probe) {
+    int64_t elapsed = now_ns() - probe.start;
+    int64_t own = elapsed - (finished_ns - probe.inner);
+    finished_ns = probe.inner + elapsed;
+    __atomic_fetch_add(&phase_ns[phase], own, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&phase_calls[phase], 1, __ATOMIC_RELAXED);
+}
+#endif
+
+int32_t probe_enable(void) {
+#ifdef NO_PROBES
+    return 1;
+#else
+    probe_enabled = 1;
+    return 0;
+#endif
+}
+
+void probe_report(FILE *file, double wall) {
+#ifdef NO_PROBES
+    fprintf(file, "wall %.3f ms\n", wall * 1e3);
+#else
+    fprintf(file, "%-10s %10s %12s %8s %12s\n", "phase", "calls", "ms", "% wall", "us/call");
+    for (int32_t i = 0; i < PROBE_PHASES; i += 1) {
+        int64_t ns = __atomic_load_n(&phase_ns[i], __ATOMIC_RELAXED);
+        int64_t calls = __atomic_load_n(&phase_calls[i], __ATOMIC_RELAXED);
+        fprintf(file, "%-10s %10lld %12.3f %8.1f %12.3f\n", phase_names[i], (long long) calls,
+                ns / 1e6, wall > 0 ? ns / 1e9 / wall * 100 : 0, calls ? ns / 1e3 / calls : 0);
+    }
+    fprintf(file, "%-10s %10s %12.3f\n", "wall", "", wall * 1e3);
+#endif
+}
@@ -0,0 +1,51 @@
+#ifndef _PROBE_H
+#define _PROBE_H 1
+
+#include <stdint.h>
+#include <stdio.h>
+
+/* Phases of the aligner timed by the probes. Each phase only counts its
+ * own time: a probe started inside another, on the same thread, is taken
+ * out of the outer one, so the loads and decomposes of optimize count as
+ * load and decompose. */
+typedef enum {
+    PROBE_LOAD,
+    PROBE_DECOMPOSE,
+    PROBE_OPTIMIZE,
+    PROBE_RENDER,
+    PROBE_FILTER,
+    PROBE_COMPOSITE,
+    PROBE_ENCODE,
+    PROBE_PHASES,
+} probe_phase_t;
+
+/* PROBE_START(t) declares t and reads the clock, PROBE_STOP(phase, t) adds
+ * the time since, less that of the probes inside, to phase. They cost a
+ * branch until probe_enable is called, and nothing when built with
+ * -DNO_PROBES. */
+#ifdef NO_PROBES
+#define PROBE_START(t) do {} while (0)
+#define PROBE_STOP(phase, t) do {} while (0)
+#else
+extern int32_t probe_enabled;
+
+typedef struct {
+    int64_t start;
+    /* The thread's time in finished probes when this one started */
+    int64_t inner;
+} probe_t;
+
+probe_t probe_start(void);
+void probe_stop(probe_phase_t phase, probe_t probe);
+
+#define PROBE_START(t) probe_t t = probe_enabled ? probe_start() : (probe_t) { 0, 0 }
+#define PROBE_STOP(phase, t) do { if (probe_enabled) probe_stop(phase, t); } while (0)
+#endif
+
+/* Start timing. Returns nonzero if the probes were compiled out. */
+int32_t probe_enable(void);
+
+/* Print the time and calls of each phase against wall seconds */
+void probe_report(FILE *file, double wall);
+
+#endif
@@ -0,0 +1,175 @@
+/*
+ * Alignment profiles. The offsets found by the face scan only depend on
+ * the font, the face, the pixel size and the emboldening, so they are
+ * stored in a profile file per font and size and mapped on later runs,
+ * which then skip the scan.
+ *
+ * A profile is a header followed by one byte per glyph, the horizontal
+ * offset optimize_placement_single finds for it, or PROFILE_UNKNOWN. The
+ * font is identified by a hash of its contents rather than its path, and
+ * the FreeType version is recorded as it decides the outlines. Files are
+ * written to a temporary name and renamed into place.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "placement.h"
+#include "profile.h"
+
+#define PROFILE_MAGIC 0x464f5250    /* "PROF" */
+#define PROFILE_FORMAT 1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t format;
+    uint64_t font_hash;
+    int32_t face_index;
+    int32_t size_in_px;
+    int32_t embolden;
+    int32_t freetype_version;
+    int32_t num_glyphs;
+    int32_t offset_x;
+    int32_t offset_y;
+    int32_t sampled;
+} profile_header_t;
+
+static uint64_t fnv1a(const uint8_t *data, size_t length) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; i ++) {
+        hash = (hash ^ data[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+static char *profile_path(const char *dir, const profile_key_t *key) {
+    char *path = malloc(strlen(dir) + 64);
+    sprintf(path, "%s/%016llx-%ld-%d.profile", dir, (unsigned long long) key->font_hash, (long) key->face_index, key->size_in_px);
+    return path;
+}
+
+int32_t profile_key(profile_key_t *key, const char *font_name, FT_Long face_index, int32_t size_in_px) {
+    int fd = open(font_name, O_RDONLY);
+    if (fd < 0) {
+        return 1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return 1;
+    }
+    void *font = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (font == MAP_FAILED) {
+        return 1;
+    }
+
+    key->font_hash = fnv1a(font, st.st_size);
+    key->face_index = face_index;
+    key->size_in_px = size_in_px;
+    munmap(font, st.st_size);
+    return 0;
+}
+
+int32_t profile_open(profile_t *profile, const char *dir, const profile_key_t *key, FT_Long num_glyphs, int32_t sample) {
+    memset(profile, 0, sizeof(profile_t));
+
+    char *path = profile_path(dir, key);
+    int fd = open(path, O_RDONLY);
+    free(path);
+    if (fd < 0) {
+        return 1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(profile_header_t)) {
+        close(fd);
+        return 1;
+    }
+    size_t length = st.st_size;
+    void *mapping = mmap(0, length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return 1;
+    }
+
+    const profile_header_t *header = mapping;
+    if (header->magic != PROFILE_MAGIC
+        || header->format != PROFILE_FORMAT
+        || header->font_hash != key->font_hash
+        || header->face_index != key->face_index
+        || header->size_in_px != key->size_in_px
+        || header->embolden != EMBOLDEN
+        || header->freetype_version != FREETYPE_MAJOR * 10000 + FREETYPE_MINOR * 100 + FREETYPE_PATCH
+        || (header->sampled && !sample)
+        || header->num_glyphs != num_glyphs
+        || length != sizeof(profile_header_t) + header->num_glyphs) {
+        munmap(mapping, length);
+        return 1;
+    }
+
+    profile->offset.x = header->offset_x;
+    profile->offset.y = header->offset_y;
+    profile->num_glyphs = header->num_glyphs;
+    profile->glyph_offsets = (const uint8_t *) (header + 1);
+    profile->mapping = mapping;
+    profile->length = length;
+    return 0;
+}
+
+void profile_close(profile_t *profile) {
+    if (profile->mapping) {
+        munmap(profile->mapping, profile->length);
+    }
+    memset(profile, 0, sizeof(profile_t));
+}
+
+void profile_save(const char *dir, const profile_key_t *key, const FT_Vector *offset, FT_Long num_glyphs, const uint8_t *glyph_offsets, int32_t sampled) {
+    profile_header_t header = {
+        .magic = PROFILE_MAGIC,
+        .format = PROFILE_FORMAT,
+        .font_hash = key->font_hash,
+        .face_index = key->face_index,
+        .size_in_px = key->size_in_px,
+        .embolden = EMBOLDEN,
+        .freetype_version = FREETYPE_MAJOR * 10000 + FREETYPE_MINOR * 100 + FREETYPE_PATCH,
+        .num_glyphs = num_glyphs,
+        .offset_x = offset->x,
+        .offset_y = offset->y,
+        .sampled = sampled
+    };
+
+    char *path = profile_path(dir, key);
+    char *temp = malloc(strlen(path) + 8);
+    sprintf(temp, "%s.XXXXXX", path);
+    int fd = mkstemp(temp);
+    if (fd < 0) {
+        fprintf(stderr, "Can't write profile %s\n", path);
+        free(temp);
+        free(path);
+        return;
+    }
+    fchmod(fd, 0644);
+
+    FILE *file = fdopen(fd, "wb");
+    int32_t ok = file
+        && fwrite(&header, sizeof(header), 1, file) == 1
+        && fwrite(glyph_offsets, num_glyphs, 1, file) == 1;
+    if (file) {
+        ok = fclose(file) == 0 && ok;
+    } else {
+        close(fd);
+    }
+    if (!ok || rename(temp, path) != 0) {
+        fprintf(stderr, "Can't write profile %s\n", path);
+        unlink(temp);
+    }
+    free(temp);
+    free(path);
+}
@@ -0,0 +1,40 @@
+#ifndef _PROFILE_H
+#define _PROFILE_H 1
+
+#include <ft2build.h>
+#include <freetype/freetype.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Glyph offset of a glyph the profile has no data for */
+#define PROFILE_UNKNOWN 0xff
+
+/* What the offsets depend on: the font contents, face and size */
+typedef struct {
+    uint64_t font_hash;
+    FT_Long face_index;
+    int32_t size_in_px;
+} profile_key_t;
+
+/* Alignment profile, read-only and mapped from the profile file */
+typedef struct {
+    FT_Vector offset;
+    FT_Long num_glyphs;
+    const uint8_t *glyph_offsets;
+    void *mapping;
+    size_t length;
+} profile_t;
+
+/* Returns 0 on success */
+int32_t profile_key(profile_key_t *key, const char *font_name, FT_Long face_index, int32_t size_in_px);
+
+/* Map the profile for key from dir. A profile from a sampled scan is only
+ * accepted when sample is set, and one for other than num_glyphs glyphs
+ * never. Returns 0 on success. */
+int32_t profile_open(profile_t *profile, const char *dir, const profile_key_t *key, FT_Long num_glyphs, int32_t sample);
+void profile_close(profile_t *profile);
+
+/* Store a profile for key in dir, replacing any old one */
+void profile_save(const char *dir, const profile_key_t *key, const FT_Vector *offset, FT_Long num_glyphs, const uint8_t *glyph_offsets, int32_t sampled);
+
+#endif
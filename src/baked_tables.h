@@ -0,0 +1,18 @@
+#ifndef _BAKED_TABLES_H
+#define _BAKED_TABLES_H 1
+
+#include <stdint.h>
+
+#include "lcdglyph.h"
+
+/* Background ranges of the baked tables, indexed by lcdg_table_id_t */
+static const uint8_t lcdg_baked_ranges[LCDG_TABLE_COUNT][2] = {
+    [LCDG_TABLE_FULL] = { 0, 255 },
+    [LCDG_TABLE_DARK] = { 0, 63 },
+    [LCDG_TABLE_LIGHT] = { 192, 255 },
+};
+
+/* Generated by gen_tables */
+extern const uint8_t lcdg_baked_tables[LCDG_TABLE_COUNT][65536] __attribute__((visibility("hidden")));
+
+#endif
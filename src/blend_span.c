@@ -0,0 +1,269 @@
+/*
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Blend a span of subpixel coverage into a packed 8-bit sRGB framebuffer
+ * using an alpha correction table. Every subpixel computes
+ *
+ *     ac = table[fg << 8 | coverage]
+ *     dst = (ac * fg + (255 - ac) * dst + 128) / 255
+ *
+ * The foreground color is fixed for the span, so each channel only ever
+ * reads a single 256-byte row of the table. The corrected alphas are
+ * collected into a small staging buffer with plain byte loads, and the
+ * blend itself runs over the staging buffer with SIMD. The division by 255
+ * is done with the exact identity x / 255 == (y + (y >> 8)) >> 8, where
+ * y = x + 1, valid for every value the blend can produce.
+ */
+#include <stdint.h>
+
+#include "lcdglyph.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HAVE_NEON 1
+#endif
+
+/* Multiple of 3 subpixels and of the widest vector, so that every chunk
+ * starts at the first byte of the foreground pattern. */
+#define CHUNK 192
+#define PATTERN 96
+
+/* fg is the foreground repeated over PATTERN bytes, starting from the
+ * channel of dst[0]. */
+typedef void (*blend_func_t)(uint8_t *dst, const uint8_t *ac, const uint8_t *fg, int32_t n);
+
+static void
+blend_scalar(uint8_t *dst, const uint8_t *ac, const uint8_t *fg, int32_t n)
+{
+    for (int32_t i = 0; i < n; i ++) {
+	uint32_t y = ac[i] * fg[i % 3] + (255 - ac[i]) * dst[i] + 129;
+	dst[i] = (y + (y >> 8)) >> 8;
+    }
+}
+
+#ifdef HAVE_X86
+__attribute__((target("sse2")))
+static __m128i
+blend_sse2_half(__m128i ac, __m128i fg, __m128i bg)
+{
+    __m128i inv = _mm_sub_epi16(_mm_set1_epi16(255), ac);
+    __m128i y = _mm_add_epi16(_mm_mullo_epi16(ac, fg), _mm_mullo_epi16(inv, bg));
+    y = _mm_add_epi16(y, _mm_set1_epi16(129));
+    return _mm_srli_epi16(_mm_add_epi16(y, _mm_srli_epi16(y, 8)), 8);
+}
+
+__attribute__((target("sse2")))
+static void
+blend_sse2(uint8_t *dst, const uint8_t *ac, const uint8_t *fg, int32_t n)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+	__m128i a = _mm_loadu_si128((const __m128i *) (ac + i));
+	__m128i f = _mm_loadu_si128((const __m128i *) (fg + i % 48));
+	__m128i b = _mm_loadu_si128((const __m128i *) (dst + i));
+	__m128i lo = blend_sse2_half(_mm_unpacklo_epi8(a, zero),
+				     _mm_unpacklo_epi8(f, zero),
+				     _mm_unpacklo_epi8(b, zero));
+	__m128i hi = blend_sse2_half(_mm_unpackhi_epi8(a, zero),
+				     _mm_unpackhi_epi8(f, zero),
+				     _mm_unpackhi_epi8(b, zero));
+	_mm_storeu_si128((__m128i *) (dst + i), _mm_packus_epi16(lo, hi));
+    }
+    blend_scalar(dst + i, ac + i, fg + i % 3, n - i);
+}
+
+__attribute__((target("avx2")))
+static __m256i
+blend_avx2_half(__m256i ac, __m256i fg, __m256i bg)
+{
+    __m256i inv = _mm256_sub_epi16(_mm256_set1_epi16(255), ac);
+    __m256i y = _mm256_add_epi16(_mm256_mullo_epi16(ac, fg), _mm256_mullo_epi16(inv, bg));
+    y = _mm256_add_epi16(y, _mm256_set1_epi16(129));
+    return _mm256_srli_epi16(_mm256_add_epi16(y, _mm256_srli_epi16(y, 8)), 8);
+}
+
+__attribute__((target("avx2")))
+static void
+blend_avx2(uint8_t *dst, const uint8_t *ac, const uint8_t *fg, int32_t n)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    int32_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+	__m256i a = _mm256_loadu_si256((const __m256i *) (ac + i));
+	__m256i f = _mm256_loadu_si256((const __m256i *) (fg + i % PATTERN));
+	__m256i b = _mm256_loadu_si256((const __m256i *) (dst + i));
+	/* unpack and pack both work within 128-bit lanes, so they cancel out */
+	__m256i lo = blend_avx2_half(_mm256_unpacklo_epi8(a, zero),
+				     _mm256_unpacklo_epi8(f, zero),
+				     _mm256_unpacklo_epi8(b, zero));
+	__m256i hi = blend_avx2_half(_mm256_unpackhi_epi8(a, zero),
+				     _mm256_unpackhi_epi8(f, zero),
+				     _mm256_unpackhi_epi8(b, zero));
+	_mm256_storeu_si256((__m256i *) (dst + i), _mm256_packus_epi16(lo, hi));
+    }
+    blend_sse2(dst + i, ac + i, fg + i % 3, n - i);
+}
+#endif
+
+#ifdef HAVE_NEON
+static void
+blend_neon(uint8_t *dst, const uint8_t *ac, const uint8_t *fg, int32_t n)
+{
+    int32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+	uint8x16_t a = vld1q_u8(ac + i);
+	uint8x16_t f = vld1q_u8(fg + i % 48);
+	uint8x16_t b = vld1q_u8(dst + i);
+	uint8x16_t inv = vmvnq_u8(a);
+	uint16x8_t lo = vmull_u8(vget_low_u8(a), vget_low_u8(f));
+	uint16x8_t hi = vmull_u8(vget_high_u8(a), vget_high_u8(f));
+	lo = vmlal_u8(lo, vget_low_u8(inv), vget_low_u8(b));
+	hi = vmlal_u8(hi, vget_high_u8(inv), vget_high_u8(b));
+	lo = vaddq_u16(lo, vdupq_n_u16(129));
+	hi = vaddq_u16(hi, vdupq_n_u16(129));
+	lo = vsraq_n_u16(lo, lo, 8);
+	hi = vsraq_n_u16(hi, hi, 8);
+	vst1q_u8(dst + i, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+    }
+    blend_scalar(dst + i, ac + i, fg + i % 3, n - i);
+}
+#endif
+
+static blend_func_t
+select_blend()
+{
+#ifdef HAVE_X86
+    if (__builtin_cpu_supports("avx2")) {
+	return blend_avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+	return blend_sse2;
+    }
+#endif
+#ifdef HAVE_NEON
+    return blend_neon;
+#endif
+    return blend_scalar;
+}
+
+/* row holds the 256 corrected alphas for each channel's foreground */
+static void
+blend_span(const uint8_t *const *row,
+	   uint8_t *dst,
+	   const uint8_t *coverage,
+	   int32_t width,
+	   const uint8_t *fg,
+	   int32_t reverse)
+{
+    blend_func_t blend = select_blend();
+
+    uint8_t pattern[PATTERN];
+    for (int32_t i = 0; i < PATTERN; i ++) {
+	pattern[i] = fg[i % 3];
+    }
+
+    /* BGR panels put the blue subpixel first, so the coverage triplet is
+     * consumed in reverse while the framebuffer stays in RGB order. */
+    int32_t c0 = reverse ? 2 : 0;
+    int32_t c2 = reverse ? 0 : 2;
+
+    uint8_t ac[CHUNK];
+    int32_t n = width * 3;
+    for (int32_t i = 0; i < n; i += CHUNK) {
+	int32_t len = n - i < CHUNK ? n - i : CHUNK;
+	const uint8_t *cov = coverage + i;
+	for (int32_t j = 0; j < len; j += 3) {
+	    ac[j + 0] = row[0][cov[j + c0]];
+	    ac[j + 1] = row[1][cov[j + 1]];
+	    ac[j + 2] = row[2][cov[j + c2]];
+	}
+	blend(dst + i, ac, pattern, len);
+    }
+}
+
+void
+lcdg_blend_span_rgb(const uint8_t *table,
+		    uint8_t *dst,
+		    const uint8_t *coverage,
+		    int32_t width,
+		    uint8_t fg_r,
+		    uint8_t fg_g,
+		    uint8_t fg_b)
+{
+    const uint8_t fg[3] = { fg_r, fg_g, fg_b };
+    const uint8_t *row[3] = { table + (fg_r << 8), table + (fg_g << 8), table + (fg_b << 8) };
+    blend_span(row, dst, coverage, width, fg, 0);
+}
+
+void
+lcdg_blend_span_bgr(const uint8_t *table,
+		    uint8_t *dst,
+		    const uint8_t *coverage,
+		    int32_t width,
+		    uint8_t fg_r,
+		    uint8_t fg_g,
+		    uint8_t fg_b)
+{
+    const uint8_t fg[3] = { fg_r, fg_g, fg_b };
+    const uint8_t *row[3] = { table + (fg_r << 8), table + (fg_g << 8), table + (fg_b << 8) };
+    blend_span(row, dst, coverage, width, fg, 1);
+}
+
+static void
+blend_span_compact(const lcdg_compact_table_t *ct,
+		   uint8_t *dst,
+		   const uint8_t *coverage,
+		   int32_t width,
+		   const uint8_t *fg,
+		   int32_t reverse)
+{
+    /* Gray and other repeated channels share their expanded row */
+    uint8_t expanded[3][256];
+    const uint8_t *row[3];
+    for (int32_t c = 0; c < 3; c ++) {
+	row[c] = expanded[c];
+	for (int32_t p = 0; p < c; p ++) {
+	    if (fg[p] == fg[c]) {
+		row[c] = row[p];
+		break;
+	    }
+	}
+	if (row[c] == expanded[c]) {
+	    lcdg_compact_row(ct, fg[c], expanded[c]);
+	}
+    }
+    blend_span(row, dst, coverage, width, fg, reverse);
+}
+
+void
+lcdg_blend_span_rgb_compact(const lcdg_compact_table_t *ct,
+			    uint8_t *dst,
+			    const uint8_t *coverage,
+			    int32_t width,
+			    uint8_t fg_r,
+			    uint8_t fg_g,
+			    uint8_t fg_b)
+{
+    const uint8_t fg[3] = { fg_r, fg_g, fg_b };
+    blend_span_compact(ct, dst, coverage, width, fg, 0);
+}
+
+void
+lcdg_blend_span_bgr_compact(const lcdg_compact_table_t *ct,
+			    uint8_t *dst,
+			    const uint8_t *coverage,
+			    int32_t width,
+			    uint8_t fg_r,
+			    uint8_t fg_g,
+			    uint8_t fg_b)
+{
+    const uint8_t fg[3] = { fg_r, fg_g, fg_b };
+    blend_span_compact(ct, dst, coverage, width, fg, 1);
+}
@@ -12,51 +12,19 @@
  * contrast is large, so large differences in components are more likely. We
  * capture this through using absolute differences in our error metric.
  */
+#define _POSIX_C_SOURCE 200809L
+
 #include <math.h>
+#include <pthread.h>
 #include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
 
+#include "build_table.h"
+#include "error_sum.h"
 #include "lcdglyph.h"
-
-static uint16_t s2l[65536];
-static uint16_t l2s[65536];
-
-static float
-srgb_to_linear(float c)
-{
-    if (c <= 0.04045f) {
-        return c / 12.92f;
-    } else {
-        return powf((c + 0.055f) / 1.055f, 2.4f);
-    }
-}
-
-static float
-linear_to_srgb(float c)
-{
-    if (c <= 0.0031308f) {
-        return c * 12.92f;
-    } else {
-        return 1.055f * powf(c, 1.0f/2.4f) - 0.055f;
-    }
-}
-
-static void
-init()
-{
-    static uint8_t inited = 0;
-    if (inited) {
-	return;
-    }
-    inited = 1;
-
-    for (int32_t c = 0; c < 65536; c ++) {
-	s2l[c] = roundf(srgb_to_linear(c / 65535.0f) * 65535.0f);
-    }
-
-    for (int32_t c = 0; c < 65536; c ++) {
-	l2s[c] = roundf(linear_to_srgb(c / 65535.0f) * 65535.0f);
-    }
-}
+#include "srgb_tables.h"
 
 /* This calculates the alpha using the best alpha for the 1.0 - fg as theory for background */
 /*
@@ -78,62 +46,430 @@ estimate_alpha(int32_t fg, int32_t alpha) {
 }
 */
 
+static int32_t
+search_early_exit(const lcdg_error_row_t *row,
+		  int32_t startac,
+		  lcdg_error_func_t error_sum,
+		  uint32_t *besterror)
+{
+    int32_t bestac = 0;
+    *besterror = 0xffffffff;
+    for (int32_t ac = startac; ac < 256; ac ++) {
+	uint32_t error = error_sum(row, ac);
+
+	/* We assume that the error function is generally U-shaped,
+	 * so we terminate search once it seems we start the latter leg of U */
+	if (error <= *besterror) {
+	    *besterror = error;
+	    bestac = ac;
+	} else {
+	    break;
+	}
+    }
+    return bestac;
+}
+
+static int64_t
+now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Work of one thread, in nanoseconds until merged */
+typedef struct {
+    lcdg_build_stats_t stats;
+    int64_t init_ns;
+    int64_t search_ns;
+} build_counts_t;
+
+static void
+build_row(uint8_t *table,
+	  float *error,
+	  int32_t fg_,
+	  int32_t startbg_,
+	  int32_t endbg_,
+	  int32_t contrast_,
+	  lcdg_fill_func_t fill,
+	  lcdg_error_func_t error_sum,
+	  build_counts_t *counts)
+{
+    int64_t mark = counts != 0 ? now_ns() : 0;
+    lcdg_error_row_t row;
+    lcdg_error_row_init(&row, lcdg_s2l, fg_, startbg_, endbg_);
+
+    /* Apply Skia-like contrast hack, which manipulates the target alpha
+     * based on the 16-bit sRGB foreground. contrast_ is at most 256,
+     * which keeps ca increasing in a and within 0 .. 255. */
+    int32_t contrast = (65535 - fg_ * 0x101) * contrast_ >> 16;
+
+    int32_t startac = 0;
+    for (int32_t a = 0; a < 256; a ++) {
+	int32_t ca = a + (a * (255 - a) * contrast >> 16);
+
+	/* The correct sRGB blend doesn't depend on the candidate alpha,
+	 * so it is computed once for all backgrounds. */
+	fill(&row, lcdg_l2s, ca);
+	if (counts != 0) {
+	    int64_t now = now_ns();
+	    counts->init_ns += now - mark;
+	    mark = now;
+	}
+
+	/* find the best ac for each (alpha, fg) pair.
+	 * f(alpha) = ac appears to be monotonic,
+	 * so we start search from the previous value. */
+//	int32_t startac = estimate_alpha(fg, a);
+	uint32_t besterror;
+	int32_t bestac = search_early_exit(&row, startac, error_sum, &besterror);
+
+	if (counts != 0) {
+	    int64_t now = now_ns();
+	    counts->search_ns += now - mark;
+	    mark = now;
+
+	    /* The search scores every ac from startac to bestac, and the
+	     * one after it that ends the search unless bestac is the last */
+	    int32_t candidates = bestac - startac + 1 + (bestac < 255);
+	    lcdg_build_stats_t *stats = &counts->stats;
+	    stats->cells ++;
+	    stats->candidates += candidates;
+	    stats->max_candidates = candidates > stats->max_candidates ? candidates : stats->max_candidates;
+	    stats->warm_start_hits += bestac == startac;
+	    stats->histogram[candidates < LCDG_BUILD_HISTOGRAM ? candidates - 1 : LCDG_BUILD_HISTOGRAM - 1] ++;
+	}
+
+	startac = bestac;
+	if (table != 0) {
+	    table[a] = bestac;
+	}
+	if (error != 0) {
+	    error[a] = sqrtf(besterror / 256.0f / 256.0f);
+	}
+    }
+}
+
+void
+lcdg_build_row(uint8_t *table,
+	       float *error,
+	       uint8_t fg,
+	       uint8_t startbg_,
+	       uint8_t endbg_)
+{
+    build_row(table, error, fg, startbg_, endbg_, 0, lcdg_select_fill_func(), lcdg_select_error_func(), 0);
+}
+
 void
 lcdg_build_table(uint8_t *table,
 		 float *error,
 		 uint8_t startbg_,
 		 uint8_t endbg_)
 {
-    init();
-
-    int32_t startbg = startbg_ * 0x101;
-    int32_t endbg = (endbg_ + 1) * 0x101;
-
-    for (int32_t fg = 0; fg < 65536; fg += 0x101) {
-	int32_t startac = 0;
-	for (int32_t a = 0; a < 256; a ++) {
-	    uint32_t besterror = 0xffffffff;
-	    int32_t bestac = 0;
-
-	    /* Apply Skia-like contrast hack, which manipulates the target alpha based on foregroud */
-	    //int32_t contrast = (65535 - fg) * 0x40 >> 16;
-	    int32_t ca = a;// + (a * (255 - a) * contrast >> 16);
-
-	    /* find the best ac for each (alpha, fg) pair.
-	     * f(alpha) = ac appears to be monotonic,
-	     * so we start search from the previous value. */
-//	    int32_t startac = estimate_alpha(fg, a);
-	    for (int32_t ac = startac; ac < 256; ac ++) {
-		uint32_t error = 0;
-		for (int32_t bg = startbg; bg < endbg; bg += 0x101) {
-		    int32_t linear_blended = (ac * fg + (255 - ac) * bg + 128) / 255;
-		    int32_t srgb_blended = l2s[(ca * s2l[fg] + (255 - ca) * s2l[bg] + 128) / 255];
-
-		    /* 12 bits */
-		    int32_t difference = (linear_blended - srgb_blended) >> 4;
-		    /* 24 bits, 32 sums */
-		    error += difference * difference;
-		}
+    lcdg_fill_func_t fill = lcdg_select_fill_func();
+    lcdg_error_func_t error_sum = lcdg_select_error_func();
+    for (int32_t row = 0; row < 256; row ++) {
+	build_row(table != 0 ? table + (row << 8) : 0,
+		  error != 0 ? error + (row << 8) : 0,
+		  row, startbg_, endbg_, 0, fill, error_sum, 0);
+    }
+}
+
+/* The warm start only carries within a foreground row, so the rows can be
+ * handed out to threads in any order without changing the result. */
+typedef struct {
+    uint8_t *table;
+    float *error;
+    int32_t startbg;
+    int32_t endbg;
+    int32_t contrast;
+    lcdg_fill_func_t fill;
+    lcdg_error_func_t error_sum;
+    int32_t next_row;
+    /* Summed counts of the threads, if wanted */
+    build_counts_t *counts;
+    pthread_mutex_t lock;
+} build_job_t;
 
-		/* We assume that the error function is generally U-shaped,
-		 * so we terminate search once it seems we start the latter leg of U */
+static void *
+build_worker(void *data)
+{
+    build_job_t *job = data;
+    build_counts_t counts;
+    memset(&counts, 0, sizeof(counts));
+    int32_t row;
+    while ((row = __sync_fetch_and_add(&job->next_row, 1)) < 256) {
+	build_row(job->table != 0 ? job->table + (row << 8) : 0,
+		  job->error != 0 ? job->error + (row << 8) : 0,
+		  row, job->startbg, job->endbg, job->contrast, job->fill, job->error_sum,
+		  job->counts != 0 ? &counts : 0);
+    }
+
+    if (job->counts != 0) {
+	pthread_mutex_lock(&job->lock);
+	lcdg_build_stats_t *total = &job->counts->stats;
+	total->cells += counts.stats.cells;
+	total->candidates += counts.stats.candidates;
+	if (counts.stats.max_candidates > total->max_candidates) {
+	    total->max_candidates = counts.stats.max_candidates;
+	}
+	total->warm_start_hits += counts.stats.warm_start_hits;
+	for (int32_t i = 0; i < LCDG_BUILD_HISTOGRAM; i ++) {
+	    total->histogram[i] += counts.stats.histogram[i];
+	}
+	job->counts->init_ns += counts.init_ns;
+	job->counts->search_ns += counts.search_ns;
+	pthread_mutex_unlock(&job->lock);
+    }
+    return 0;
+}
+
+static void
+build_table(uint8_t *table,
+	    float *error,
+	    uint8_t startbg_,
+	    uint8_t endbg_,
+	    int32_t contrast,
+	    int32_t nthreads,
+	    lcdg_build_stats_t *stats)
+{
+    if (nthreads <= 0) {
+	nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (nthreads > 256) {
+	nthreads = 256;
+    }
+
+    build_job_t job = {
+	.table = table,
+	.error = error,
+	.startbg = startbg_,
+	.endbg = endbg_,
+	.contrast = contrast,
+	.fill = lcdg_select_fill_func(),
+	.error_sum = lcdg_select_error_func(),
+	.next_row = 0,
+	.counts = 0
+    };
+    build_counts_t counts;
+    if (stats != 0) {
+	memset(&counts, 0, sizeof(counts));
+	job.counts = &counts;
+	pthread_mutex_init(&job.lock, 0);
+    }
+
+    /* The calling thread works as well; a thread that fails to start
+     * just leaves its share of rows to the others. */
+    pthread_t threads[256];
+    int32_t started = 0;
+    for (int32_t i = 1; i < nthreads; i ++) {
+	if (pthread_create(&threads[started], 0, build_worker, &job) == 0) {
+	    started ++;
+	}
+    }
+    build_worker(&job);
+    for (int32_t i = 0; i < started; i ++) {
+	pthread_join(threads[i], 0);
+    }
+
+    if (stats != 0) {
+	pthread_mutex_destroy(&job.lock);
+	*stats = counts.stats;
+	stats->init_seconds = counts.init_ns / 1e9;
+	stats->search_seconds = counts.search_ns / 1e9;
+    }
+}
+
+void
+lcdg_build_table_contrast(uint8_t *table,
+			  float *error,
+			  uint8_t startbg_,
+			  uint8_t endbg_,
+			  int32_t contrast,
+			  int32_t nthreads)
+{
+    build_table(table, error, startbg_, endbg_, contrast, nthreads, 0);
+}
+
+void
+lcdg_build_table_mt(uint8_t *table,
+		    float *error,
+		    uint8_t startbg_,
+		    uint8_t endbg_,
+		    int32_t nthreads)
+{
+    build_table(table, error, startbg_, endbg_, 0, nthreads, 0);
+}
+
+void
+lcdg_build_table_stats(uint8_t *table,
+		       float *error,
+		       uint8_t startbg_,
+		       uint8_t endbg_,
+		       int32_t nthreads,
+		       lcdg_build_stats_t *stats)
+{
+    build_table(table, error, startbg_, endbg_, 0, nthreads, stats);
+}
+
+/* The exhaustive search doesn't trust the U shape. It relies on the error
+ * terms being rounded versions of (X - S) / 16, where X is the exact
+ * linear blend, which is linear in ac. Rounding the blend and shifting the
+ * difference moves each term by -0.969 .. 0.032, so against the real
+ * valued e = (X - S) / 16 + ERROR_CENTER every integer term d satisfies
+ * |d - e| <= ERROR_SLACK, and therefore d^2 >= e^2 - 2 * ERROR_SLACK * |e|.
+ * Summed over the n backgrounds this bounds the error from below by
+ * Q - 2 * ERROR_SLACK * sqrt(n * Q), where Q = sum of e^2 is a quadratic
+ * in ac. Every candidate whose bound exceeds an error that has already
+ * been seen can be discarded, and the remaining window is scored in
+ * blocks of 16 candidates. */
+#define ERROR_CENTER -0.4685
+#define ERROR_SLACK 0.5
+
+static void
+error_quadratic(const lcdg_error_row_t *row,
+		const double *slope,
+		double *linear,
+		double *constant)
+{
+    *linear = 0;
+    *constant = 0;
+    for (int32_t i = 0; i < row->count; i ++) {
+	int32_t srgb_blended = row->srgb_hi[i] << 4 | row->srgb_lo[i];
+	double offset = (row->bg[i] * 257.0 - srgb_blended) / 16.0 + ERROR_CENTER;
+	*linear += offset * slope[i];
+	*constant += offset * offset;
+    }
+}
+
+/* Range of ac where Q(ac) = quadratic * ac^2 + 2 * linear * ac + constant
+ * is small enough for the error to possibly be no more than besterror */
+static void
+search_window(double quadratic,
+	      double linear,
+	      double constant,
+	      int32_t count,
+	      uint32_t besterror,
+	      int32_t *lo,
+	      int32_t *hi)
+{
+    *lo = 0;
+    *hi = 255;
+    if (quadratic <= 0) {
+	return;
+    }
+
+    double t = ERROR_SLACK * sqrt(count) + sqrt(ERROR_SLACK * ERROR_SLACK * count + besterror);
+    double limit = t * t * (1 + 1e-9) + 1e-6;
+    double discriminant = linear * linear - quadratic * (constant - limit);
+    if (discriminant < 0) {
+	discriminant = 0;
+    }
+    double center = -linear / quadratic;
+    double radius = sqrt(discriminant) / quadratic;
+    double from = floor(center - radius - 1e-6);
+    double to = ceil(center + radius + 1e-6);
+    *lo = from < 0 ? 0 : from > 255 ? 255 : from;
+    *hi = to < 0 ? 0 : to > 255 ? 255 : to;
+}
+
+static int32_t
+build_row_exhaustive(uint8_t *table,
+		     float *error,
+		     uint8_t *worse,
+		     int32_t fg_,
+		     int32_t startbg_,
+		     int32_t endbg_,
+		     lcdg_fill_func_t fill,
+		     lcdg_error_func_t error_sum,
+		     lcdg_block_func_t block)
+{
+    lcdg_error_row_t row;
+    lcdg_error_row_init(&row, lcdg_s2l, fg_, startbg_, endbg_);
+
+    /* Slope of each error term with respect to ac, which only depends on
+     * the foreground and background */
+    double slope[256];
+    double quadratic = 0;
+    for (int32_t i = 0; i < row.count; i ++) {
+	slope[i] = 257.0 * (fg_ - row.bg[i]) / 255.0 / 16.0;
+	quadratic += slope[i] * slope[i];
+    }
+
+    int32_t worse_count = 0;
+    int32_t startac = 0;
+    for (int32_t a = 0; a < 256; a ++) {
+	int32_t ca = a;
+	fill(&row, lcdg_l2s, ca);
+
+	/* Start from the minimum of Q, which is usually the answer */
+	double linear, constant;
+	error_quadratic(&row, slope, &linear, &constant);
+	double center = quadratic > 0 ? -linear / quadratic : 0;
+	int32_t guess = center < 0 ? 0 : center > 255 ? 255 : lrint(center);
+	uint32_t besterror = error_sum(&row, guess);
+
+	int32_t lo, hi;
+	search_window(quadratic, linear, constant, row.count, besterror, &lo, &hi);
+
+	/* Both kernels do 16 candidate and background pairs per step, but
+	 * error_sum pads the backgrounds and block pads the candidates. */
+	uint32_t guesserror = besterror;
+	int32_t bestac = lo;
+	besterror = 0xffffffff;
+	if ((hi - lo + 1) * row.length <= (hi - lo + 16) / 16 * 16 * row.count) {
+	    for (int32_t ac = lo; ac <= hi; ac ++) {
+		uint32_t error = ac == guess ? guesserror : error_sum(&row, ac);
 		if (error <= besterror) {
 		    besterror = error;
 		    bestac = ac;
-		} else {
-		    break;
 		}
 	    }
-
-	    startac = bestac;
-	    if (table != 0) {
-		*table = bestac;
-		table ++;
-	    }
-	    if (error != 0) {
-		*error = sqrtf(besterror / 256.0f / 256.0f);
-		error ++;
+	} else {
+	    for (int32_t ac0 = lo; ac0 <= hi; ac0 += 16) {
+		uint32_t blockerror;
+		int32_t blockac = block(&row, ac0, &blockerror);
+		if (blockerror <= besterror) {
+		    besterror = blockerror;
+		    bestac = blockac;
+		}
 	    }
 	}
+
+	if (worse != 0) {
+	    /* Replay the early exit search with its own warm start */
+	    uint32_t early_error;
+	    startac = search_early_exit(&row, startac, error_sum, &early_error);
+	    worse[a] = early_error > besterror;
+	    worse_count += worse[a];
+	}
+
+	if (table != 0) {
+	    table[a] = bestac;
+	}
+	if (error != 0) {
+	    error[a] = sqrtf(besterror / 256.0f / 256.0f);
+	}
+    }
+    return worse_count;
+}
+
+int32_t
+lcdg_build_table_exhaustive(uint8_t *table,
+			    float *error,
+			    uint8_t startbg_,
+			    uint8_t endbg_,
+			    uint8_t *worse)
+{
+    lcdg_fill_func_t fill = lcdg_select_fill_func();
+    lcdg_error_func_t error_sum = lcdg_select_error_func();
+    lcdg_block_func_t block = lcdg_select_block_func();
+    int32_t worse_count = 0;
+    for (int32_t row = 0; row < 256; row ++) {
+	worse_count += build_row_exhaustive(table != 0 ? table + (row << 8) : 0,
+					    error != 0 ? error + (row << 8) : 0,
+					    worse != 0 ? worse + (row << 8) : 0,
+					    row, startbg_, endbg_, fill, error_sum, block);
     }
+    return worse_count;
 }
@@ -0,0 +1,14 @@
+#ifndef _BUILD_TABLE_H
+#define _BUILD_TABLE_H 1
+
+#include <stdint.h>
+
+#include "error_sum.h"
+
+/* One foreground row of lcdg_build_table, 256 entries indexed by alpha */
+LCDG_HIDDEN void lcdg_build_row(uint8_t *table, float *error, uint8_t fg, uint8_t bg_start, uint8_t bg_end);
+
+/* lcdg_build_table_mt with the contrast hack, contrast 0 .. 256 */
+LCDG_HIDDEN void lcdg_build_table_contrast(uint8_t *table, float *error, uint8_t bg_start, uint8_t bg_end, int32_t contrast, int32_t nthreads);
+
+#endif
@@ -0,0 +1,168 @@
+/*
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Compact approximation of an alpha correction table. Neighbouring
+ * foreground rows differ by only a unit or two, so only every step'th row
+ * and the last one are kept, and the rows between are linearly
+ * interpolated from the two key rows around them. With the default step of
+ * 16 the 64 kB table shrinks to 17 rows, a little over 4 kB, and stays
+ * within one unit of the exact table. Expanding a row is cheap enough to
+ * do once per span, so a blend loop keeps its whole working set in L1.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "lcdglyph.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+struct lcdg_compact_table {
+    int32_t step;
+    int32_t count;
+    /* Per foreground: the key row below it and the weight of the one
+     * above, in 1/256ths */
+    uint8_t key[256];
+    uint16_t weight[256];
+    uint8_t rows[][256];
+};
+
+typedef void (*lerp_func_t)(uint8_t *row, const uint8_t *k0, const uint8_t *k1, int32_t w);
+
+static void
+lerp_scalar(uint8_t *row, const uint8_t *k0, const uint8_t *k1, int32_t w)
+{
+    for (int32_t a = 0; a < 256; a ++) {
+	row[a] = (k0[a] * (256 - w) + k1[a] * w + 128) >> 8;
+    }
+}
+
+#ifdef HAVE_X86
+__attribute__((target("sse2")))
+static void
+lerp_sse2(uint8_t *row, const uint8_t *k0, const uint8_t *k1, int32_t w)
+{
+    /* Both products fit 16 bits since the weights add up to 256 */
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i w0 = _mm_set1_epi16(256 - w);
+    const __m128i w1 = _mm_set1_epi16(w);
+    const __m128i round = _mm_set1_epi16(128);
+    for (int32_t a = 0; a < 256; a += 16) {
+	__m128i x = _mm_loadu_si128((const __m128i *) (k0 + a));
+	__m128i y = _mm_loadu_si128((const __m128i *) (k1 + a));
+	__m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(x, zero), w0),
+				   _mm_mullo_epi16(_mm_unpacklo_epi8(y, zero), w1));
+	__m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(x, zero), w0),
+				   _mm_mullo_epi16(_mm_unpackhi_epi8(y, zero), w1));
+	lo = _mm_srli_epi16(_mm_add_epi16(lo, round), 8);
+	hi = _mm_srli_epi16(_mm_add_epi16(hi, round), 8);
+	_mm_storeu_si128((__m128i *) (row + a), _mm_packus_epi16(lo, hi));
+    }
+}
+
+__attribute__((target("avx2")))
+static void
+lerp_avx2(uint8_t *row, const uint8_t *k0, const uint8_t *k1, int32_t w)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i w0 = _mm256_set1_epi16(256 - w);
+    const __m256i w1 = _mm256_set1_epi16(w);
+    const __m256i round = _mm256_set1_epi16(128);
+    for (int32_t a = 0; a < 256; a += 32) {
+	__m256i x = _mm256_loadu_si256((const __m256i *) (k0 + a));
+	__m256i y = _mm256_loadu_si256((const __m256i *) (k1 + a));
+	/* unpack and pack both work within 128-bit lanes, so they cancel out */
+	__m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(x, zero), w0),
+				      _mm256_mullo_epi16(_mm256_unpacklo_epi8(y, zero), w1));
+	__m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(x, zero), w0),
+				      _mm256_mullo_epi16(_mm256_unpackhi_epi8(y, zero), w1));
+	lo = _mm256_srli_epi16(_mm256_add_epi16(lo, round), 8);
+	hi = _mm256_srli_epi16(_mm256_add_epi16(hi, round), 8);
+	_mm256_storeu_si256((__m256i *) (row + a), _mm256_packus_epi16(lo, hi));
+    }
+}
+#endif
+
+static lerp_func_t
+select_lerp()
+{
+#ifdef HAVE_X86
+    if (__builtin_cpu_supports("avx2")) {
+	return lerp_avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+	return lerp_sse2;
+    }
+#endif
+    return lerp_scalar;
+}
+
+lcdg_compact_table_t *
+lcdg_compact_table_new(const uint8_t *table, int32_t step, int32_t *max_error)
+{
+    if (step < 1 || step > 255) {
+	return 0;
+    }
+
+    int32_t count = (255 + step - 1) / step + 1;
+    lcdg_compact_table_t *ct = malloc(sizeof(*ct) + count * 256);
+    if (ct == 0) {
+	return 0;
+    }
+    ct->step = step;
+    ct->count = count;
+
+    for (int32_t k = 0; k < count; k ++) {
+	int32_t fg = k * step < 255 ? k * step : 255;
+	for (int32_t a = 0; a < 256; a ++) {
+	    ct->rows[k][a] = table[fg << 8 | a];
+	}
+    }
+
+    for (int32_t fg = 0; fg < 256; fg ++) {
+	int32_t k = fg / step;
+	int32_t f0 = k * step;
+	int32_t f1 = f0 + step < 255 ? f0 + step : 255;
+	ct->key[fg] = k;
+	ct->weight[fg] = fg == f0 ? 0 : ((fg - f0) * 256 + (f1 - f0) / 2) / (f1 - f0);
+    }
+
+    if (max_error != 0) {
+	uint8_t row[256];
+	*max_error = 0;
+	for (int32_t fg = 0; fg < 256; fg ++) {
+	    lcdg_compact_row(ct, fg, row);
+	    for (int32_t a = 0; a < 256; a ++) {
+		int32_t e = abs(row[a] - table[fg << 8 | a]);
+		if (e > *max_error) {
+		    *max_error = e;
+		}
+	    }
+	}
+    }
+    return ct;
+}
+
+void
+lcdg_compact_row(const lcdg_compact_table_t *ct, uint8_t fg, uint8_t *row)
+{
+    int32_t k = ct->key[fg];
+    int32_t w = ct->weight[fg];
+    /* The key row past the last one is never weighted, don't read it */
+    select_lerp()(row, ct->rows[k], ct->rows[w != 0 ? k + 1 : k], w);
+}
+
+size_t
+lcdg_compact_table_size(const lcdg_compact_table_t *ct)
+{
+    return sizeof(*ct) + ct->count * 256;
+}
+
+void
+lcdg_compact_table_free(lcdg_compact_table_t *ct)
+{
+    free(ct);
+}
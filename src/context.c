@@ -0,0 +1,116 @@
+/*
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Library context: a set of settings and the tables built for them. All of
+ * it is built in lcdg_context_new and never written again, so a context
+ * can be shared between any number of threads without locking, and
+ * callers with different settings don't interfere. The sRGB lookup tables
+ * are read-only data generated at build time and need no setup.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "baked_tables.h"
+#include "build_table.h"
+#include "lcdglyph.h"
+
+struct lcdg_context {
+    lcdg_settings_t settings;
+    const uint8_t *table;
+    const float *error;
+    /* Tables built for this context, 0 when baked ones are used */
+    uint8_t *built_table;
+    float *built_error;
+};
+
+void
+lcdg_settings_default(lcdg_settings_t *settings)
+{
+    settings->bg_start = 0;
+    settings->bg_end = 255;
+    settings->contrast = 0;
+    settings->with_error = 0;
+    settings->nthreads = 0;
+}
+
+/* Baked table for exactly these settings, if there is one */
+static const uint8_t *
+find_baked(const lcdg_settings_t *settings)
+{
+    if (settings->contrast != 0 || settings->with_error) {
+	return 0;
+    }
+    for (int32_t id = 0; id < LCDG_TABLE_COUNT; id ++) {
+	if (lcdg_baked_ranges[id][0] == settings->bg_start && lcdg_baked_ranges[id][1] == settings->bg_end) {
+	    return lcdg_get_baked_table(id);
+	}
+    }
+    return 0;
+}
+
+lcdg_context_t *
+lcdg_context_new(const lcdg_settings_t *settings)
+{
+    lcdg_settings_t defaults;
+    if (settings == 0) {
+	lcdg_settings_default(&defaults);
+	settings = &defaults;
+    }
+    if (settings->bg_start > settings->bg_end || settings->contrast < 0 || settings->contrast > 256) {
+	return 0;
+    }
+
+    lcdg_context_t *ctx = calloc(1, sizeof(*ctx));
+    if (ctx == 0) {
+	return 0;
+    }
+    ctx->settings = *settings;
+
+    ctx->table = find_baked(settings);
+    if (ctx->table != 0) {
+	return ctx;
+    }
+
+    ctx->built_table = malloc(65536);
+    ctx->built_error = settings->with_error ? malloc(65536 * sizeof(float)) : 0;
+    if (ctx->built_table == 0 || (settings->with_error && ctx->built_error == 0)) {
+	lcdg_context_free(ctx);
+	return 0;
+    }
+    lcdg_build_table_contrast(ctx->built_table, ctx->built_error,
+			      settings->bg_start, settings->bg_end,
+			      settings->contrast, settings->nthreads);
+    ctx->table = ctx->built_table;
+    ctx->error = ctx->built_error;
+    return ctx;
+}
+
+const lcdg_settings_t *
+lcdg_context_settings(const lcdg_context_t *ctx)
+{
+    return &ctx->settings;
+}
+
+const uint8_t *
+lcdg_context_table(const lcdg_context_t *ctx)
+{
+    return ctx->table;
+}
+
+const float *
+lcdg_context_error(const lcdg_context_t *ctx)
+{
+    return ctx->error;
+}
+
+void
+lcdg_context_free(lcdg_context_t *ctx)
+{
+    if (ctx == 0) {
+	return;
+    }
+    free(ctx->built_table);
+    free(ctx->built_error);
+    free(ctx);
+}
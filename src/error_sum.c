@@ -0,0 +1,288 @@
+/*
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Error metric of the table optimizer, evaluated for one candidate alpha
+ * over a whole row of backgrounds. This is the innermost loop of
+ * lcdg_build_table(), and it must produce exactly the same sums as
+ *
+ *     linear_blended = (ac * fg + (255 - ac) * bg + 128) / 255
+ *     difference = (linear_blended - srgb_blended) >> 4
+ *     error += difference * difference
+ *
+ * with fg and bg being 8-bit values scaled by 0x101. The vector kernels
+ * work on 16-bit lanes. With v = ac * fg + (255 - ac) * bg in 8-bit
+ * terms, the blend is v * 257 / 255, which is computed exactly as
+ * v + 2 * (v / 255) + (2 * (v % 255) + 128) / 255. The shift of the
+ * difference is done separately on the high and low parts of both terms
+ * so that no intermediate value leaves 16 bits.
+ *
+ * Filling in the correct sRGB blends costs as much as evaluating one
+ * candidate, so it is vectorized as well, with the division by 255 done
+ * in floating point and corrected by the remainder.
+ *
+ * The AVX2 block kernel scores 16 consecutive candidates at once, one
+ * candidate per lane, and picks the best of them with a vector minimum.
+ * The SSE2 and scalar ones just call error_sum for each candidate.
+ */
+#include <stdint.h>
+
+#include "error_sum.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+static void
+set_srgb(lcdg_error_row_t *row, int32_t i, uint16_t srgb_blended)
+{
+    row->srgb_hi[i] = srgb_blended >> 4;
+    row->srgb_lo[i] = srgb_blended & 15;
+}
+
+void
+lcdg_error_row_init(lcdg_error_row_t *row, const uint16_t *s2l, int32_t fg, int32_t startbg, int32_t endbg)
+{
+    row->fg = fg;
+    row->fg_lin = s2l[fg];
+    row->count = endbg - startbg + 1;
+    row->length = (row->count + 15) & ~15;
+    for (int32_t i = 0; i < row->length; i ++) {
+	/* Padding blends fg over itself, which has no error */
+	int32_t bg = i < row->count ? startbg + i : fg;
+	row->bg[i] = bg;
+	row->bg_lin[i] = s2l[bg];
+	set_srgb(row, i, fg * 0x101);
+    }
+}
+
+static void
+fill_scalar(lcdg_error_row_t *row, const uint16_t *l2s, int32_t ca)
+{
+    for (int32_t i = 0; i < row->count; i ++) {
+	set_srgb(row, i, l2s[(ca * row->fg_lin + (255 - ca) * row->bg_lin[i] + 128) / 255]);
+    }
+}
+
+static uint32_t
+error_scalar(const lcdg_error_row_t *row, int32_t ac)
+{
+    int32_t fg = row->fg * 0x101;
+    uint32_t error = 0;
+    for (int32_t i = 0; i < row->length; i ++) {
+	int32_t bg = row->bg[i] * 0x101;
+	int32_t srgb_blended = row->srgb_hi[i] << 4 | row->srgb_lo[i];
+	int32_t linear_blended = (ac * fg + (255 - ac) * bg + 128) / 255;
+	int32_t difference = (linear_blended - srgb_blended) >> 4;
+	error += difference * difference;
+    }
+    return error;
+}
+
+static int32_t
+block_generic(const lcdg_error_row_t *row, int32_t ac0, uint32_t *besterror, lcdg_error_func_t error_sum)
+{
+    int32_t bestac = ac0;
+    *besterror = 0xffffffff;
+    for (int32_t ac = ac0; ac < ac0 + 16 && ac < 256; ac ++) {
+	uint32_t error = error_sum(row, ac);
+	if (error <= *besterror) {
+	    *besterror = error;
+	    bestac = ac;
+	}
+    }
+    return bestac;
+}
+
+static int32_t
+block_scalar(const lcdg_error_row_t *row, int32_t ac0, uint32_t *besterror)
+{
+    return block_generic(row, ac0, besterror, error_scalar);
+}
+
+#ifdef HAVE_X86
+__attribute__((target("sse2")))
+static uint32_t
+error_sse2(const lcdg_error_row_t *row, int32_t ac)
+{
+    const __m128i acv = _mm_set1_epi16(ac);
+    const __m128i fgv = _mm_mullo_epi16(acv, _mm_set1_epi16(row->fg));
+    const __m128i inv = _mm_set1_epi16(255 - ac);
+    __m128i sum = _mm_setzero_si128();
+    for (int32_t i = 0; i < row->length; i += 8) {
+	__m128i bg = _mm_load_si128((const __m128i *) (row->bg + i));
+	__m128i v = _mm_add_epi16(fgv, _mm_mullo_epi16(inv, bg));
+	__m128i q = _mm_srli_epi16(_mm_mulhi_epu16(v, _mm_set1_epi16(0x8081)), 7);
+	__m128i r = _mm_sub_epi16(v, _mm_mullo_epi16(q, _mm_set1_epi16(255)));
+	__m128i z = _mm_add_epi16(_mm_add_epi16(r, r), _mm_set1_epi16(129));
+	z = _mm_srli_epi16(_mm_add_epi16(z, _mm_srli_epi16(z, 8)), 8);
+	__m128i linear = _mm_add_epi16(_mm_add_epi16(v, _mm_add_epi16(q, q)), z);
+
+	__m128i hi = _mm_load_si128((const __m128i *) (row->srgb_hi + i));
+	__m128i lo = _mm_load_si128((const __m128i *) (row->srgb_lo + i));
+	__m128i borrow = _mm_cmpgt_epi16(lo, _mm_and_si128(linear, _mm_set1_epi16(15)));
+	__m128i difference = _mm_add_epi16(_mm_sub_epi16(_mm_srli_epi16(linear, 4), hi), borrow);
+	sum = _mm_add_epi32(sum, _mm_madd_epi16(difference, difference));
+    }
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(sum);
+}
+
+static int32_t
+block_sse2(const lcdg_error_row_t *row, int32_t ac0, uint32_t *besterror)
+{
+    return block_generic(row, ac0, besterror, error_sse2);
+}
+
+__attribute__((target("avx2")))
+static uint32_t
+error_avx2(const lcdg_error_row_t *row, int32_t ac)
+{
+    const __m256i acv = _mm256_set1_epi16(ac);
+    const __m256i fgv = _mm256_mullo_epi16(acv, _mm256_set1_epi16(row->fg));
+    const __m256i inv = _mm256_set1_epi16(255 - ac);
+    __m256i sum = _mm256_setzero_si256();
+    for (int32_t i = 0; i < row->length; i += 16) {
+	__m256i bg = _mm256_load_si256((const __m256i *) (row->bg + i));
+	__m256i v = _mm256_add_epi16(fgv, _mm256_mullo_epi16(inv, bg));
+	__m256i q = _mm256_srli_epi16(_mm256_mulhi_epu16(v, _mm256_set1_epi16(0x8081)), 7);
+	__m256i r = _mm256_sub_epi16(v, _mm256_mullo_epi16(q, _mm256_set1_epi16(255)));
+	__m256i z = _mm256_add_epi16(_mm256_add_epi16(r, r), _mm256_set1_epi16(129));
+	z = _mm256_srli_epi16(_mm256_add_epi16(z, _mm256_srli_epi16(z, 8)), 8);
+	__m256i linear = _mm256_add_epi16(_mm256_add_epi16(v, _mm256_add_epi16(q, q)), z);
+
+	__m256i hi = _mm256_load_si256((const __m256i *) (row->srgb_hi + i));
+	__m256i lo = _mm256_load_si256((const __m256i *) (row->srgb_lo + i));
+	__m256i borrow = _mm256_cmpgt_epi16(lo, _mm256_and_si256(linear, _mm256_set1_epi16(15)));
+	__m256i difference = _mm256_add_epi16(_mm256_sub_epi16(_mm256_srli_epi16(linear, 4), hi), borrow);
+	sum = _mm256_add_epi32(sum, _mm256_madd_epi16(difference, difference));
+    }
+    __m128i sum4 = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    sum4 = _mm_add_epi32(sum4, _mm_shuffle_epi32(sum4, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum4 = _mm_add_epi32(sum4, _mm_shuffle_epi32(sum4, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(sum4);
+}
+
+__attribute__((target("avx2")))
+static void
+fill_avx2(lcdg_error_row_t *row, const uint16_t *l2s, int32_t ca)
+{
+    const __m256i fg = _mm256_set1_epi32(ca * row->fg_lin + 128);
+    const __m256i inv = _mm256_set1_epi32(255 - ca);
+    int32_t i = 0;
+    for (; i + 8 <= row->count; i += 8) {
+	__m256i bg = _mm256_load_si256((const __m256i *) (row->bg_lin + i));
+	__m256i x = _mm256_add_epi32(fg, _mm256_mullo_epi32(inv, bg));
+	/* x is below 2^24, so the estimate is off by one at most */
+	__m256i q = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(x), _mm256_set1_ps(1.0f / 255.0f)));
+	__m256i r = _mm256_sub_epi32(x, _mm256_mullo_epi32(q, _mm256_set1_epi32(255)));
+	q = _mm256_add_epi32(q, _mm256_cmpgt_epi32(_mm256_setzero_si256(), r));
+	q = _mm256_sub_epi32(q, _mm256_cmpgt_epi32(r, _mm256_set1_epi32(254)));
+
+	__m256i srgb = _mm256_and_si256(_mm256_i32gather_epi32((const int *) l2s, q, 2), _mm256_set1_epi32(0xffff));
+	__m256i hi = _mm256_srli_epi32(srgb, 4);
+	__m256i lo = _mm256_and_si256(srgb, _mm256_set1_epi32(15));
+	hi = _mm256_permute4x64_epi64(_mm256_packus_epi32(hi, hi), _MM_SHUFFLE(0, 0, 2, 0));
+	lo = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, lo), _MM_SHUFFLE(0, 0, 2, 0));
+	_mm_storeu_si128((__m128i *) (row->srgb_hi + i), _mm256_castsi256_si128(hi));
+	_mm_storeu_si128((__m128i *) (row->srgb_lo + i), _mm256_castsi256_si128(lo));
+    }
+    for (; i < row->count; i ++) {
+	set_srgb(row, i, l2s[(ca * row->fg_lin + (255 - ca) * row->bg_lin[i] + 128) / 255]);
+    }
+}
+__attribute__((target("avx2")))
+static int32_t
+block_avx2(const lcdg_error_row_t *row, int32_t ac0, uint32_t *besterror)
+{
+    const __m256i ac = _mm256_add_epi16(_mm256_set1_epi16(ac0),
+					_mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    const __m256i fg = _mm256_mullo_epi16(ac, _mm256_set1_epi16(row->fg));
+    const __m256i inv = _mm256_sub_epi16(_mm256_set1_epi16(255), ac);
+    __m256i even = _mm256_setzero_si256();
+    __m256i odd = _mm256_setzero_si256();
+    for (int32_t i = 0; i < row->count; i ++) {
+	__m256i v = _mm256_add_epi16(fg, _mm256_mullo_epi16(inv, _mm256_set1_epi16(row->bg[i])));
+	__m256i q = _mm256_srli_epi16(_mm256_mulhi_epu16(v, _mm256_set1_epi16(0x8081)), 7);
+	__m256i r = _mm256_sub_epi16(v, _mm256_mullo_epi16(q, _mm256_set1_epi16(255)));
+	__m256i z = _mm256_add_epi16(_mm256_add_epi16(r, r), _mm256_set1_epi16(129));
+	z = _mm256_srli_epi16(_mm256_add_epi16(z, _mm256_srli_epi16(z, 8)), 8);
+	__m256i linear = _mm256_add_epi16(_mm256_add_epi16(v, _mm256_add_epi16(q, q)), z);
+
+	__m256i borrow = _mm256_cmpgt_epi16(_mm256_set1_epi16(row->srgb_lo[i]),
+					    _mm256_and_si256(linear, _mm256_set1_epi16(15)));
+	__m256i difference = _mm256_add_epi16(_mm256_sub_epi16(_mm256_srli_epi16(linear, 4),
+							       _mm256_set1_epi16(row->srgb_hi[i])), borrow);
+	/* Square the candidates separately instead of summing pairs */
+	__m256i de = _mm256_and_si256(difference, _mm256_set1_epi32(0xffff));
+	__m256i dodd = _mm256_srli_epi32(difference, 16);
+	even = _mm256_add_epi32(even, _mm256_madd_epi16(de, de));
+	odd = _mm256_add_epi32(odd, _mm256_madd_epi16(dodd, dodd));
+    }
+
+    /* Lane j of even is candidate ac0 + 2j, of odd ac0 + 2j + 1. Candidates
+     * past 255 don't exist and must never win. */
+    __m256i index = _mm256_add_epi32(_mm256_set1_epi32(ac0), _mm256_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14));
+    even = _mm256_or_si256(even, _mm256_cmpgt_epi32(index, _mm256_set1_epi32(255)));
+    odd = _mm256_or_si256(odd, _mm256_cmpgt_epi32(index, _mm256_set1_epi32(254)));
+
+    __m256i min = _mm256_min_epu32(even, odd);
+    min = _mm256_min_epu32(min, _mm256_permute2x128_si256(min, min, 1));
+    min = _mm256_min_epu32(min, _mm256_shuffle_epi32(min, _MM_SHUFFLE(1, 0, 3, 2)));
+    min = _mm256_min_epu32(min, _mm256_shuffle_epi32(min, _MM_SHUFFLE(2, 3, 0, 1)));
+    int32_t even_hits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(even, min)));
+    int32_t odd_hits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(odd, min)));
+
+    /* Ties go to the largest candidate, like they do in the early exit search */
+    int32_t best = -1;
+    if (even_hits != 0) {
+	best = 2 * (31 - __builtin_clz(even_hits));
+    }
+    if (odd_hits != 0 && 2 * (31 - __builtin_clz(odd_hits)) + 1 > best) {
+	best = 2 * (31 - __builtin_clz(odd_hits)) + 1;
+    }
+    *besterror = _mm_cvtsi128_si32(_mm256_castsi256_si128(min));
+    return ac0 + best;
+}
+#endif
+
+lcdg_fill_func_t
+lcdg_select_fill_func()
+{
+#ifdef HAVE_X86
+    if (__builtin_cpu_supports("avx2")) {
+	return fill_avx2;
+    }
+#endif
+    return fill_scalar;
+}
+
+lcdg_error_func_t
+lcdg_select_error_func()
+{
+#ifdef HAVE_X86
+    if (__builtin_cpu_supports("avx2")) {
+	return error_avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+	return error_sse2;
+    }
+#endif
+    return error_scalar;
+}
+
+lcdg_block_func_t
+lcdg_select_block_func()
+{
+#ifdef HAVE_X86
+    if (__builtin_cpu_supports("avx2")) {
+	return block_avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+	return block_sse2;
+    }
+#endif
+    return block_scalar;
+}
@@ -0,0 +1,42 @@
+#ifndef _ERROR_SUM_H
+#define _ERROR_SUM_H 1
+
+#include <stdint.h>
+
+#define LCDG_HIDDEN __attribute__((visibility("hidden")))
+
+/* The part of the error function that does not depend on the candidate
+ * alpha, for one (fg, alpha) pair. Each entry is a background and the
+ * correctly blended sRGB value against it, split into the bits above and
+ * below the 4 bits that the error metric drops. The arrays hold count
+ * backgrounds and are padded to length, a multiple of 16, with entries
+ * that produce no error. */
+typedef struct {
+    uint16_t bg[256] __attribute__((aligned(32)));
+    uint16_t srgb_hi[256] __attribute__((aligned(32)));
+    uint16_t srgb_lo[256] __attribute__((aligned(32)));
+    int32_t bg_lin[256] __attribute__((aligned(32)));
+    int32_t fg_lin;
+    int32_t fg;
+    int32_t count;
+    int32_t length;
+} lcdg_error_row_t;
+
+/* Fill in the sRGB blends of fg_lin and bg_lin with alpha ca. l2s must be
+ * readable one element past its end. */
+typedef void (*lcdg_fill_func_t)(lcdg_error_row_t *row, const uint16_t *l2s, int32_t ca);
+
+/* Sum of squared errors of blending fg with alpha ac in sRGB space */
+typedef uint32_t (*lcdg_error_func_t)(const lcdg_error_row_t *row, int32_t ac);
+
+/* Best of the candidates ac0 .. ac0 + 15, ignoring those past 255 */
+typedef int32_t (*lcdg_block_func_t)(const lcdg_error_row_t *row, int32_t ac0, uint32_t *besterror);
+
+/* s2l is indexed by 8-bit sRGB */
+LCDG_HIDDEN void lcdg_error_row_init(lcdg_error_row_t *row, const uint16_t *s2l, int32_t fg, int32_t startbg, int32_t endbg);
+
+LCDG_HIDDEN lcdg_fill_func_t lcdg_select_fill_func();
+LCDG_HIDDEN lcdg_error_func_t lcdg_select_error_func();
+LCDG_HIDDEN lcdg_block_func_t lcdg_select_block_func();
+
+#endif
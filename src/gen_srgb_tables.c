@@ -0,0 +1,71 @@
+/* 
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Emit the sRGB <-> linear conversion tables used by the table optimizer
+ * as C source, so that the library carries them as read-only data instead
+ * of evaluating powf 131072 times on first use.
+ *
+ * The optimizer only converts 8-bit sRGB values to linear, so s2l has 256
+ * entries. Blends are converted back from arbitrary 16-bit linear values,
+ * so l2s has 65536 entries and one more of padding for the vectorized
+ * gathers.
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+static float
+srgb_to_linear(float c)
+{
+    if (c <= 0.04045f) {
+        return c / 12.92f;
+    } else {
+        return powf((c + 0.055f) / 1.055f, 2.4f);
+    }
+}
+
+static float
+linear_to_srgb(float c)
+{
+    if (c <= 0.0031308f) {
+        return c * 12.92f;
+    } else {
+        return 1.055f * powf(c, 1.0f/2.4f) - 0.055f;
+    }
+}
+
+static void
+print_table(const char *name, const uint16_t *table, int32_t length)
+{
+    fprintf(stdout, "const uint16_t %s[%d] = {\n", name, length);
+    for (int32_t i = 0; i < length; i ++) {
+	fprintf(stdout, "%d,", table[i]);
+	if ((i & 15) == 15 || i == length - 1) {
+	    fprintf(stdout, "\n");
+	}
+    }
+    fprintf(stdout, "};\n");
+}
+
+int
+main(int argc, char **argv)
+{
+    static uint16_t s2l[256];
+    static uint16_t l2s[65536 + 1];
+
+    for (int32_t c = 0; c < 256; c ++) {
+	s2l[c] = roundf(srgb_to_linear(c * 0x101 / 65535.0f) * 65535.0f);
+    }
+
+    for (int32_t c = 0; c < 65536; c ++) {
+	l2s[c] = roundf(linear_to_srgb(c / 65535.0f) * 65535.0f);
+    }
+    l2s[65536] = l2s[65535];
+
+    fprintf(stdout, "/* Generated by gen_srgb_tables, do not edit */\n");
+    fprintf(stdout, "#include \"srgb_tables.h\"\n\n");
+    print_table("lcdg_s2l", s2l, 256);
+    print_table("lcdg_l2s", l2s, 65536 + 1);
+    return 0;
+}
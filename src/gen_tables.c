@@ -0,0 +1,37 @@
+/* 
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Emit the baked alpha correction tables as C source. The tables are
+ * built with lcdg_build_table at library build time and end up as
+ * read-only data, so every process linking the library shares one copy
+ * and pays nothing to use them.
+ */
+#include <stdint.h>
+#include <stdio.h>
+
+#include "baked_tables.h"
+#include "lcdglyph.h"
+
+int
+main(int argc, char **argv)
+{
+    static uint8_t table[65536];
+
+    fprintf(stdout, "/* Generated by gen_tables, do not edit */\n");
+    fprintf(stdout, "#include \"baked_tables.h\"\n\n");
+    fprintf(stdout, "const uint8_t lcdg_baked_tables[LCDG_TABLE_COUNT][65536] = {\n");
+    for (int32_t id = 0; id < LCDG_TABLE_COUNT; id ++) {
+	lcdg_build_table_mt(table, 0, lcdg_baked_ranges[id][0], lcdg_baked_ranges[id][1], 0);
+	fprintf(stdout, "{\n");
+	for (int32_t i = 0; i < 65536; i ++) {
+	    fprintf(stdout, "%d,", table[i]);
+	    if ((i & 255) == 255) {
+		fprintf(stdout, "\n");
+	    }
+	}
+	fprintf(stdout, "},\n");
+    }
+    fprintf(stdout, "};\n");
+    return 0;
+}
@@ -0,0 +1,202 @@
+/*
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Table that follows a changing background range. Every cell holds a local
+ * minimum of the error, found by walking downhill from the previous
+ * optimum, together with the error at it and at its two neighbours. The
+ * error is a sum over backgrounds, so when the range moves those three
+ * sums can be patched with just the backgrounds that left or joined the
+ * range. Only where that leaves a neighbour better than the stored alpha
+ * is the cell searched again, with a full row of backgrounds.
+ *
+ * For a shift of a few backgrounds this is a few dozen scalar error terms
+ * per cell instead of filling in the blends of the whole range, which is
+ * what dominates lcdg_build_table. The result is not always the alpha that
+ * lcdg_build_table would pick, as its early exit finds a different local
+ * minimum now and then, but it is equally close to optimal.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "error_sum.h"
+#include "lcdglyph.h"
+#include "srgb_tables.h"
+
+struct lcdg_incremental {
+    int32_t bg_start;
+    int32_t bg_end;
+    uint8_t table[65536];
+    /* Error at the alpha in table, and at one less and one more */
+    uint32_t error[65536];
+    uint32_t below[65536];
+    uint32_t above[65536];
+};
+
+/* One background's term of the error, as in error_scalar */
+static int32_t
+error_term(int32_t fg, int32_t bg, int32_t srgb_blended, int32_t ac)
+{
+    int32_t linear_blended = (ac * fg * 0x101 + (255 - ac) * bg * 0x101 + 128) / 255;
+    int32_t difference = (linear_blended - srgb_blended) >> 4;
+    return difference * difference;
+}
+
+/* Walk downhill from seed, preferring larger ac on ties like the other
+ * searches, so the result has a strictly worse neighbour above and no
+ * better one below. Their errors come out of the walk as well. */
+static int32_t
+search_local(const lcdg_error_row_t *row,
+	     int32_t seed,
+	     lcdg_error_func_t error_sum,
+	     uint32_t *besterror,
+	     uint32_t *below,
+	     uint32_t *above)
+{
+    int32_t bestac = seed;
+    *besterror = error_sum(row, seed);
+    *below = 0;
+    *above = 0;
+    for (int32_t ac = seed + 1; ac < 256; ac ++) {
+	uint32_t error = error_sum(row, ac);
+	if (error > *besterror) {
+	    *above = error;
+	    break;
+	}
+	*below = *besterror;
+	*besterror = error;
+	bestac = ac;
+    }
+    if (bestac != seed) {
+	return bestac;
+    }
+    for (int32_t ac = seed - 1; ac >= 0; ac --) {
+	uint32_t error = error_sum(row, ac);
+	if (error >= *besterror) {
+	    *below = error;
+	    break;
+	}
+	*above = *besterror;
+	*besterror = error;
+	bestac = ac;
+    }
+    return bestac;
+}
+
+static int32_t
+update(lcdg_incremental_t *inc, int32_t startbg, int32_t endbg, int32_t rebuild)
+{
+    /* Backgrounds leaving the range count negatively */
+    int32_t changed[256];
+    int32_t sign[256];
+    int32_t nchanged = 0;
+    for (int32_t bg = 0; bg < 256; bg ++) {
+	int32_t was = inc->bg_start <= bg && bg <= inc->bg_end;
+	int32_t is = startbg <= bg && bg <= endbg;
+	if (was != is) {
+	    changed[nchanged] = bg;
+	    sign[nchanged] = is ? 1 : -1;
+	    nchanged ++;
+	}
+    }
+    inc->bg_start = startbg;
+    inc->bg_end = endbg;
+    if (nchanged == 0 && !rebuild) {
+	return 0;
+    }
+
+    /* Past a few backgrounds too many optima move for patching to pay off.
+     * A rebuild seeds each search from the row's previous alpha instead,
+     * like lcdg_build_table, as the old optima are then far off. */
+    if (nchanged * 16 > endbg - startbg + 1) {
+	rebuild = 1;
+    }
+
+    lcdg_fill_func_t fill = lcdg_select_fill_func();
+    lcdg_error_func_t error_sum = lcdg_select_error_func();
+    int32_t changed_lin[256];
+    for (int32_t j = 0; j < nchanged; j ++) {
+	changed_lin[j] = lcdg_s2l[changed[j]];
+    }
+
+    int32_t searched = 0;
+    for (int32_t fg = 0; fg < 256; fg ++) {
+	lcdg_error_row_t row;
+	int32_t row_ready = 0;
+	int32_t fg_lin = lcdg_s2l[fg];
+	for (int32_t a = 0; a < 256; a ++) {
+	    int32_t i = fg << 8 | a;
+	    int32_t ac = inc->table[i];
+
+	    if (!rebuild) {
+		int32_t error = 0, below = 0, above = 0;
+		for (int32_t j = 0; j < nchanged; j ++) {
+		    int32_t srgb_blended = lcdg_l2s[(a * fg_lin + (255 - a) * changed_lin[j] + 128) / 255];
+		    error += sign[j] * error_term(fg, changed[j], srgb_blended, ac);
+		    if (ac > 0) {
+			below += sign[j] * error_term(fg, changed[j], srgb_blended, ac - 1);
+		    }
+		    if (ac < 255) {
+			above += sign[j] * error_term(fg, changed[j], srgb_blended, ac + 1);
+		    }
+		}
+		inc->error[i] += error;
+		inc->below[i] += below;
+		inc->above[i] += above;
+		if ((ac == 0 || inc->below[i] >= inc->error[i])
+		    && (ac == 255 || inc->above[i] > inc->error[i])) {
+		    continue;
+		}
+	    }
+
+	    if (!row_ready) {
+		lcdg_error_row_init(&row, lcdg_s2l, fg, startbg, endbg);
+		row_ready = 1;
+	    }
+	    fill(&row, lcdg_l2s, a);
+	    if (rebuild) {
+		ac = a > 0 ? inc->table[i - 1] : 0;
+	    }
+	    inc->table[i] = search_local(&row, ac, error_sum, &inc->error[i], &inc->below[i], &inc->above[i]);
+	    searched ++;
+	}
+    }
+    return searched;
+}
+
+lcdg_incremental_t *
+lcdg_incremental_new(uint8_t bg_start, uint8_t bg_end)
+{
+    if (bg_start > bg_end) {
+	return 0;
+    }
+    lcdg_incremental_t *inc = malloc(sizeof(*inc));
+    if (inc == 0) {
+	return 0;
+    }
+    inc->bg_start = bg_start;
+    inc->bg_end = bg_end;
+    update(inc, bg_start, bg_end, 1);
+    return inc;
+}
+
+int32_t
+lcdg_incremental_update(lcdg_incremental_t *inc, uint8_t bg_start, uint8_t bg_end)
+{
+    if (bg_start > bg_end) {
+	return -1;
+    }
+    return update(inc, bg_start, bg_end, 0);
+}
+
+const uint8_t *
+lcdg_incremental_table(const lcdg_incremental_t *inc)
+{
+    return inc->table;
+}
+
+void
+lcdg_incremental_free(lcdg_incremental_t *inc)
+{
+    free(inc);
+}
@@ -0,0 +1,69 @@
+/*
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Alpha correction table that builds each foreground row on first use.
+ * Rows of the optimizer are independent of each other, so a renderer
+ * that only ever draws with a few colors only pays for those rows.
+ *
+ * Rows are published with a compare-and-swap. Threads that race on the
+ * same missing row all build it, one of them wins, and the others throw
+ * their copy away, so readers never wait on a lock.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "build_table.h"
+#include "lcdglyph.h"
+
+struct lcdg_lazy_table {
+    uint8_t bg_start;
+    uint8_t bg_end;
+    uint8_t *rows[256];
+};
+
+lcdg_lazy_table_t *
+lcdg_lazy_table_new(uint8_t bg_start, uint8_t bg_end)
+{
+    lcdg_lazy_table_t *t = calloc(1, sizeof(*t));
+    if (t == 0) {
+	return 0;
+    }
+    t->bg_start = bg_start;
+    t->bg_end = bg_end;
+    return t;
+}
+
+const uint8_t *
+lcdg_table_row(lcdg_lazy_table_t *t, uint8_t fg)
+{
+    uint8_t *row = __atomic_load_n(&t->rows[fg], __ATOMIC_ACQUIRE);
+    if (row != 0) {
+	return row;
+    }
+
+    row = malloc(256);
+    if (row == 0) {
+	return 0;
+    }
+    lcdg_build_row(row, 0, fg, t->bg_start, t->bg_end);
+
+    uint8_t *expected = 0;
+    if (!__atomic_compare_exchange_n(&t->rows[fg], &expected, row, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+	free(row);
+	row = expected;
+    }
+    return row;
+}
+
+void
+lcdg_lazy_table_free(lcdg_lazy_table_t *t)
+{
+    if (t == 0) {
+	return;
+    }
+    for (int32_t fg = 0; fg < 256; fg ++) {
+	free(t->rows[fg]);
+    }
+    free(t);
+}
@@ -1,10 +1,160 @@
 #ifndef _LCDGLYPH_H
 #define _LCDGLYPH_H 1
 
+#include <stddef.h>
 #include <stdint.h>
 
-uint8_t *lcdg_get_default_table();
+/* Tables baked into the library at build time, for common background ranges */
+typedef enum {
+    LCDG_TABLE_FULL,	/* backgrounds 0 - 255, the default table */
+    LCDG_TABLE_DARK,	/* backgrounds 0 - 63, for dark themes */
+    LCDG_TABLE_LIGHT,	/* backgrounds 192 - 255, for light themes */
+    LCDG_TABLE_COUNT
+} lcdg_table_id_t;
+
+const uint8_t *lcdg_get_default_table();
+
+const uint8_t *lcdg_get_baked_table(lcdg_table_id_t id);
+
+/* The narrowest baked table whose background range covers bg_start - bg_end */
+const uint8_t *lcdg_find_baked_table(uint8_t bg_start, uint8_t bg_end);
 
 void lcdg_build_table(uint8_t *table, float *error, uint8_t bg_start, uint8_t bg_end);
 
+/* Same result as lcdg_build_table, rows spread over nthreads (<= 0: one per CPU) */
+void lcdg_build_table_mt(uint8_t *table, float *error, uint8_t bg_start, uint8_t bg_end, int32_t nthreads);
+
+/* Work done building a table. Each (fg, alpha) cell is a search over ac
+ * starting from the previous alpha's optimum. The times are summed over
+ * the threads. */
+#define LCDG_BUILD_HISTOGRAM 16
+
+typedef struct {
+    uint64_t cells;
+    uint64_t candidates;	/* ac values scored over all cells */
+    uint32_t max_candidates;	/* most ac values scored in one cell */
+    uint64_t warm_start_hits;	/* cells whose optimum was where the search started */
+    /* Cells by ac values scored, 1 .. LCDG_BUILD_HISTOGRAM - 1 and more */
+    uint64_t histogram[LCDG_BUILD_HISTOGRAM];
+    double init_seconds;	/* setting up the backgrounds and correct blends */
+    double search_seconds;	/* scoring the candidates */
+} lcdg_build_stats_t;
+
+/* lcdg_build_table_mt, also filling in stats */
+void lcdg_build_table_stats(uint8_t *table, float *error, uint8_t bg_start, uint8_t bg_end, int32_t nthreads, lcdg_build_stats_t *stats);
+
+/* Table kept up to date with a changing background range. After a small
+ * move only the cells whose optimum may have moved are searched again,
+ * starting from the previous optimum. */
+typedef struct lcdg_incremental lcdg_incremental_t;
+
+lcdg_incremental_t *lcdg_incremental_new(uint8_t bg_start, uint8_t bg_end);
+
+/* Returns the number of cells searched again */
+int32_t lcdg_incremental_update(lcdg_incremental_t *inc, uint8_t bg_start, uint8_t bg_end);
+const uint8_t *lcdg_incremental_table(const lcdg_incremental_t *inc);
+void lcdg_incremental_free(lcdg_incremental_t *inc);
+
+/* Guaranteed optimal table, a reference for validating lcdg_build_table
+ * rather than a faster way to build: it takes about three times as long.
+ * If worse is given, cells where lcdg_build_table's early exit picks a
+ * worse alpha are set to 1. Returns the number of them. */
+int32_t lcdg_build_table_exhaustive(uint8_t *table, float *error, uint8_t bg_start, uint8_t bg_end, uint8_t *worse);
+
+/* A table from the on-disk cache, read-only. error is 0 unless requested. */
+typedef struct {
+    const uint8_t *table;
+    const float *error;
+    void *mapping;
+    size_t length;
+} lcdg_cached_table_t;
+
+/* Map the table for bg_start - bg_end from the cache directory dir, building
+ * and storing it if it is missing or invalid. Returns 0 on success. */
+int32_t lcdg_cache_open(lcdg_cached_table_t *cached, const char *dir, uint8_t bg_start, uint8_t bg_end, int32_t with_error);
+void lcdg_cache_close(lcdg_cached_table_t *cached);
+
+/* Table that builds its foreground rows on first use, safe to share between threads */
+typedef struct lcdg_lazy_table lcdg_lazy_table_t;
+
+lcdg_lazy_table_t *lcdg_lazy_table_new(uint8_t bg_start, uint8_t bg_end);
+
+/* Row of 256 corrected alphas for fg, indexed by alpha. 0 if out of memory. */
+const uint8_t *lcdg_table_row(lcdg_lazy_table_t *t, uint8_t fg);
+
+void lcdg_lazy_table_free(lcdg_lazy_table_t *t);
+
+/* Table keeping every step'th foreground row and interpolating between them.
+ * If max_error is given, it is set to the largest difference from table. */
+typedef struct lcdg_compact_table lcdg_compact_table_t;
+
+lcdg_compact_table_t *lcdg_compact_table_new(const uint8_t *table, int32_t step, int32_t *max_error);
+
+/* Expand the 256 corrected alphas for fg into row */
+void lcdg_compact_row(const lcdg_compact_table_t *ct, uint8_t fg, uint8_t *row);
+
+/* Bytes used by ct */
+size_t lcdg_compact_table_size(const lcdg_compact_table_t *ct);
+
+void lcdg_compact_table_free(lcdg_compact_table_t *ct);
+
+/* Settings of a context. contrast 0 - 256 strengthens the alpha of dark
+ * foregrounds like Skia does, scaled by how dark the foreground is in
+ * sRGB. 0x40 is close to Skia and 0 disables it. */
+typedef struct {
+    uint8_t bg_start;
+    uint8_t bg_end;
+    int32_t contrast;
+    int32_t with_error;	/* also keep the error array */
+    int32_t nthreads;	/* for building, <= 0: one per CPU */
+} lcdg_settings_t;
+
+void lcdg_settings_default(lcdg_settings_t *settings);
+
+/* Tables built for one set of settings. Read-only once created, so it may
+ * be shared between threads. settings 0 means the defaults. Returns 0 if
+ * the settings are invalid or memory runs out. */
+typedef struct lcdg_context lcdg_context_t;
+
+lcdg_context_t *lcdg_context_new(const lcdg_settings_t *settings);
+const lcdg_settings_t *lcdg_context_settings(const lcdg_context_t *ctx);
+const uint8_t *lcdg_context_table(const lcdg_context_t *ctx);
+/* 0 unless with_error was set */
+const float *lcdg_context_error(const lcdg_context_t *ctx);
+void lcdg_context_free(lcdg_context_t *ctx);
+
+/* Tables for background ranges, widened to multiples of quantum and built
+ * on a worker thread. Each table costs 64 kB of the memory budget. */
+typedef struct lcdg_range_cache lcdg_range_cache_t;
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t pending;	/* requested again before being built */
+    uint64_t builds;
+    uint64_t evictions;
+    int32_t entries;
+    size_t bytes;	/* 64 kB per entry */
+} lcdg_range_cache_stats_t;
+
+lcdg_range_cache_t *lcdg_range_cache_new(int32_t quantum, size_t budget);
+
+/* The table for the range if it is built, otherwise the closest baked one
+ * while it gets built. Pass it to lcdg_range_cache_release when done. */
+const uint8_t *lcdg_range_cache_acquire(lcdg_range_cache_t *cache, uint8_t bg_start, uint8_t bg_end);
+void lcdg_range_cache_release(lcdg_range_cache_t *cache, const uint8_t *table);
+
+void lcdg_range_cache_stats(lcdg_range_cache_t *cache, lcdg_range_cache_stats_t *stats);
+
+/* Every acquired table must be released first */
+void lcdg_range_cache_free(lcdg_range_cache_t *cache);
+
+/* Blend width pixels of 3 subpixel coverages each into packed 8-bit sRGB dst */
+void lcdg_blend_span_rgb(const uint8_t *table, uint8_t *dst, const uint8_t *coverage, int32_t width, uint8_t fg_r, uint8_t fg_g, uint8_t fg_b);
+void lcdg_blend_span_bgr(const uint8_t *table, uint8_t *dst, const uint8_t *coverage, int32_t width, uint8_t fg_r, uint8_t fg_g, uint8_t fg_b);
+
+/* Same, with the rows expanded from a compact table */
+void lcdg_blend_span_rgb_compact(const lcdg_compact_table_t *ct, uint8_t *dst, const uint8_t *coverage, int32_t width, uint8_t fg_r, uint8_t fg_g, uint8_t fg_b);
+void lcdg_blend_span_bgr_compact(const lcdg_compact_table_t *ct, uint8_t *dst, const uint8_t *coverage, int32_t width, uint8_t fg_r, uint8_t fg_g, uint8_t fg_b);
+
 #endif
@@ -0,0 +1,264 @@
+/*
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Cache of tables for background ranges, built in the background. Ranges
+ * are widened to multiples of the quantum, so nearby requests share a
+ * table. A request for a range that isn't built yet queues it for the
+ * worker thread and gets the closest baked table in the meantime, which is
+ * the default table unless a narrower baked one covers the range.
+ *
+ * Every entry, whether queued or built, is charged a full table against
+ * the memory budget, and the least recently used ones are dropped to stay
+ * within it. Tables handed out are reference counted, so an entry evicted
+ * while in use is only freed on its last release. The worker builds the
+ * most recently requested queued range first, as that is the one most
+ * likely to still be wanted.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "lcdglyph.h"
+
+typedef enum {
+    ENTRY_QUEUED,
+    ENTRY_BUILDING,
+    ENTRY_READY
+} entry_state_t;
+
+typedef struct entry {
+    struct entry *prev;
+    struct entry *next;
+    uint8_t bg_start;
+    uint8_t bg_end;
+    entry_state_t state;
+    int32_t refs;
+    int32_t linked;
+    uint8_t table[65536];
+} entry_t;
+
+/* What an entry costs of the budget. The bookkeeping around the table is
+ * not charged. */
+#define TABLE_COST 65536
+
+struct lcdg_range_cache {
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_t worker;
+    int32_t stop;
+    int32_t quantum;
+    int32_t capacity;
+    int32_t count;
+    /* Most recently used first */
+    entry_t *head;
+    entry_t *tail;
+    lcdg_range_cache_stats_t stats;
+};
+
+static void
+unlink_entry(lcdg_range_cache_t *cache, entry_t *e)
+{
+    if (e->prev != 0) {
+	e->prev->next = e->next;
+    } else {
+	cache->head = e->next;
+    }
+    if (e->next != 0) {
+	e->next->prev = e->prev;
+    } else {
+	cache->tail = e->prev;
+    }
+    e->prev = e->next = 0;
+    e->linked = 0;
+    cache->count --;
+}
+
+static void
+push_front(lcdg_range_cache_t *cache, entry_t *e)
+{
+    e->prev = 0;
+    e->next = cache->head;
+    if (cache->head != 0) {
+	cache->head->prev = e;
+    } else {
+	cache->tail = e;
+    }
+    cache->head = e;
+    e->linked = 1;
+    cache->count ++;
+}
+
+/* Drop least recently used entries until there is room for one more. The
+ * entry being built is left alone, the worker still writes into it, so
+ * with a budget of a single table the cache may briefly hold two. */
+static void
+make_room(lcdg_range_cache_t *cache)
+{
+    entry_t *e = cache->tail;
+    while (cache->count >= cache->capacity && e != 0) {
+	entry_t *prev = e->prev;
+	if (e->state != ENTRY_BUILDING) {
+	    unlink_entry(cache, e);
+	    cache->stats.evictions ++;
+	    if (e->refs == 0) {
+		free(e);
+	    }
+	}
+	e = prev;
+    }
+}
+
+static void *
+worker(void *data)
+{
+    lcdg_range_cache_t *cache = data;
+    pthread_mutex_lock(&cache->lock);
+    while (!cache->stop) {
+	entry_t *e = cache->head;
+	while (e != 0 && e->state != ENTRY_QUEUED) {
+	    e = e->next;
+	}
+	if (e == 0) {
+	    pthread_cond_wait(&cache->wake, &cache->lock);
+	    continue;
+	}
+
+	e->state = ENTRY_BUILDING;
+	pthread_mutex_unlock(&cache->lock);
+	lcdg_build_table(e->table, 0, e->bg_start, e->bg_end);
+	pthread_mutex_lock(&cache->lock);
+	e->state = ENTRY_READY;
+	cache->stats.builds ++;
+    }
+    pthread_mutex_unlock(&cache->lock);
+    return 0;
+}
+
+lcdg_range_cache_t *
+lcdg_range_cache_new(int32_t quantum, size_t budget)
+{
+    if (quantum < 1 || quantum > 256) {
+	return 0;
+    }
+
+    lcdg_range_cache_t *cache = calloc(1, sizeof(*cache));
+    if (cache == 0) {
+	return 0;
+    }
+    cache->quantum = quantum;
+    cache->capacity = budget / TABLE_COST;
+    if (cache->capacity < 1) {
+	cache->capacity = 1;
+    }
+
+    pthread_mutex_init(&cache->lock, 0);
+    pthread_cond_init(&cache->wake, 0);
+    if (pthread_create(&cache->worker, 0, worker, cache) != 0) {
+	pthread_cond_destroy(&cache->wake);
+	pthread_mutex_destroy(&cache->lock);
+	free(cache);
+	return 0;
+    }
+    return cache;
+}
+
+const uint8_t *
+lcdg_range_cache_acquire(lcdg_range_cache_t *cache, uint8_t bg_start, uint8_t bg_end)
+{
+    int32_t q = cache->quantum;
+    int32_t start = bg_start / q * q;
+    int32_t end = (bg_end / q + 1) * q - 1;
+    if (end > 255) {
+	end = 255;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    entry_t *e = cache->head;
+    while (e != 0 && (e->bg_start != start || e->bg_end != end)) {
+	e = e->next;
+    }
+
+    if (e != 0) {
+	unlink_entry(cache, e);
+	push_front(cache, e);
+	if (e->state == ENTRY_READY) {
+	    cache->stats.hits ++;
+	    e->refs ++;
+	    pthread_mutex_unlock(&cache->lock);
+	    return e->table;
+	}
+	cache->stats.pending ++;
+    } else {
+	cache->stats.misses ++;
+	e = malloc(sizeof(*e));
+	if (e != 0) {
+	    make_room(cache);
+	    e->bg_start = start;
+	    e->bg_end = end;
+	    e->state = ENTRY_QUEUED;
+	    e->refs = 0;
+	    push_front(cache, e);
+	}
+    }
+    /* Also move an already queued range ahead of older requests */
+    pthread_cond_signal(&cache->wake);
+    pthread_mutex_unlock(&cache->lock);
+
+    return lcdg_find_baked_table(bg_start, bg_end);
+}
+
+void
+lcdg_range_cache_release(lcdg_range_cache_t *cache, const uint8_t *table)
+{
+    for (int32_t id = 0; id < LCDG_TABLE_COUNT; id ++) {
+	if (table == lcdg_get_baked_table(id)) {
+	    return;
+	}
+    }
+
+    entry_t *e = (entry_t *) (table - offsetof(entry_t, table));
+    pthread_mutex_lock(&cache->lock);
+    e->refs --;
+    if (e->refs == 0 && !e->linked) {
+	free(e);
+    }
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void
+lcdg_range_cache_stats(lcdg_range_cache_t *cache, lcdg_range_cache_stats_t *stats)
+{
+    pthread_mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    stats->entries = cache->count;
+    stats->bytes = (size_t) cache->count * TABLE_COST;
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void
+lcdg_range_cache_free(lcdg_range_cache_t *cache)
+{
+    if (cache == 0) {
+	return;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    cache->stop = 1;
+    pthread_cond_signal(&cache->wake);
+    pthread_mutex_unlock(&cache->lock);
+    pthread_join(cache->worker, 0);
+
+    entry_t *e = cache->head;
+    while (e != 0) {
+	entry_t *next = e->next;
+	free(e);
+	e = next;
+    }
+    pthread_cond_destroy(&cache->wake);
+    pthread_mutex_destroy(&cache->lock);
+    free(cache);
+}
@@ -0,0 +1,12 @@
+#ifndef _SRGB_TABLES_H
+#define _SRGB_TABLES_H 1
+
+#include <stdint.h>
+
+/* 8-bit sRGB to 16-bit linear */
+extern const uint16_t lcdg_s2l[256] __attribute__((visibility("hidden")));
+
+/* 16-bit linear to 16-bit sRGB, readable one element past the end */
+extern const uint16_t lcdg_l2s[65536 + 1] __attribute__((visibility("hidden")));
+
+#endif
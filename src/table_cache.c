@@ -0,0 +1,200 @@
+/*
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Cache of built alpha correction tables on disk. Each background range
+ * gets its own file in the cache directory, holding a header, the table
+ * and optionally the error array. A valid file is mapped read-only and
+ * used in place, so later processes neither build the table nor copy it.
+ *
+ * Files are replaced by renaming a completed temporary file over them, so
+ * readers never see a partial file. Anything that doesn't check out, be it
+ * a different format or algorithm version, another background range, a
+ * wrong size or a bad checksum, is rebuilt and written again.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "lcdglyph.h"
+
+#define CACHE_MAGIC 0x4744434c	/* "LCDG" */
+#define CACHE_FORMAT 1
+
+/* Bump whenever lcdg_build_table changes its output */
+#define ALGORITHM_VERSION 1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t format;
+    uint32_t algorithm;
+    uint32_t checksum;
+    uint8_t bg_start;
+    uint8_t bg_end;
+    uint8_t has_error;
+    uint8_t reserved[64 - 19];
+} cache_header_t;
+
+static uint32_t
+checksum(const uint8_t *data, size_t length)
+{
+    /* FNV-1a */
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i ++) {
+	hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static size_t
+payload_length(int32_t has_error)
+{
+    return 65536 + (has_error ? 65536 * sizeof(float) : 0);
+}
+
+static int32_t
+map_file(lcdg_cached_table_t *cached, const char *path, uint8_t bg_start, uint8_t bg_end, int32_t with_error)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+	return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(cache_header_t)) {
+	close(fd);
+	return -1;
+    }
+
+    size_t length = st.st_size;
+    void *mapping = mmap(0, length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+	return -1;
+    }
+
+    const cache_header_t *header = mapping;
+    const uint8_t *payload = (const uint8_t *) (header + 1);
+    if (header->magic != CACHE_MAGIC
+	|| header->format != CACHE_FORMAT
+	|| header->algorithm != ALGORITHM_VERSION
+	|| header->bg_start != bg_start
+	|| header->bg_end != bg_end
+	|| (with_error && !header->has_error)
+	|| length != sizeof(cache_header_t) + payload_length(header->has_error)
+	|| header->checksum != checksum(payload, payload_length(header->has_error))) {
+	munmap(mapping, length);
+	return -1;
+    }
+
+    cached->table = payload;
+    cached->error = with_error ? (const float *) (payload + 65536) : 0;
+    cached->mapping = mapping;
+    cached->length = length;
+    return 0;
+}
+
+static void
+write_file(const char *path, const cache_header_t *header, const uint8_t *table, const float *error)
+{
+    char *temp = malloc(strlen(path) + 8);
+    if (temp == 0) {
+	return;
+    }
+    sprintf(temp, "%s.XXXXXX", path);
+
+    int fd = mkstemp(temp);
+    if (fd < 0) {
+	free(temp);
+	return;
+    }
+
+    /* mkstemp creates the file private to the user */
+    fchmod(fd, 0644);
+
+    FILE *file = fdopen(fd, "wb");
+    int32_t ok = file != 0
+	&& fwrite(header, sizeof(*header), 1, file) == 1
+	&& fwrite(table, 65536, 1, file) == 1
+	&& (error == 0 || fwrite(error, 65536 * sizeof(float), 1, file) == 1);
+    if (file != 0) {
+	ok = fclose(file) == 0 && ok;
+    } else {
+	close(fd);
+    }
+
+    if (!ok || rename(temp, path) != 0) {
+	unlink(temp);
+    }
+    free(temp);
+}
+
+int32_t
+lcdg_cache_open(lcdg_cached_table_t *cached,
+		const char *dir,
+		uint8_t bg_start,
+		uint8_t bg_end,
+		int32_t with_error)
+{
+    memset(cached, 0, sizeof(*cached));
+
+    char *path = malloc(strlen(dir) + 64);
+    if (path == 0) {
+	return -1;
+    }
+    sprintf(path, "%s/lcdg-v%d-%d-%d.table", dir, ALGORITHM_VERSION, bg_start, bg_end);
+
+    if (map_file(cached, path, bg_start, bg_end, with_error) == 0) {
+	free(path);
+	return 0;
+    }
+
+    /* Missing, stale or corrupt: build it, and keep the built copy even
+     * when the cache can't be written. */
+    size_t length = sizeof(cache_header_t) + payload_length(with_error);
+    cache_header_t *header = calloc(1, length);
+    if (header == 0) {
+	free(path);
+	return -1;
+    }
+    uint8_t *table = (uint8_t *) (header + 1);
+    float *error = with_error ? (float *) (table + 65536) : 0;
+    lcdg_build_table_mt(table, error, bg_start, bg_end, 0);
+
+    header->magic = CACHE_MAGIC;
+    header->format = CACHE_FORMAT;
+    header->algorithm = ALGORITHM_VERSION;
+    header->bg_start = bg_start;
+    header->bg_end = bg_end;
+    header->has_error = with_error != 0;
+    header->checksum = checksum((const uint8_t *) (header + 1), payload_length(with_error));
+    write_file(path, header, table, error);
+    free(path);
+
+    cached->table = table;
+    cached->error = error;
+    cached->mapping = header;
+    cached->length = 0;
+    return 0;
+}
+
+void
+lcdg_cache_close(lcdg_cached_table_t *cached)
+{
+    if (cached->mapping == 0) {
+	return;
+    }
+    if (cached->length != 0) {
+	munmap(cached->mapping, cached->length);
+    } else {
+	free(cached->mapping);
+    }
+    memset(cached, 0, sizeof(*cached));
+}
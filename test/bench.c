@@ -0,0 +1,287 @@
+/*
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Benchmarks of table building, blending, glyph alignment and the whole
+ * aligner. Every case runs a few times unmeasured to warm up, then is
+ * timed over repeated runs. The median and 99th percentile of each case
+ * go to stdout as JSON, for comparing builds, and a summary to stderr.
+ *
+ * The alignment cases need a font and are skipped without one. The
+ * end-to-end case runs the aligner binary as a separate process.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <lcdglyph.h>
+#include <spawn.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <ft2build.h>
+#include <freetype/freetype.h>
+
+#include "placement.h"
+
+#define ALIGNER "../glyph-positional-optimization/ft-glyph-aligner"
+
+typedef void (*bench_func_t)(void *arg);
+
+static int32_t warmup = 2;
+static int32_t runs = 10;
+static int32_t first_result = 1;
+
+static int64_t
+now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static int
+compare_ns(const void *a, const void *b)
+{
+    int64_t x = *(const int64_t *) a, y = *(const int64_t *) b;
+    return (x > y) - (x < y);
+}
+
+/* Time func and report it. items is the number of operations in one call,
+ * bytes the amount of data it goes through, or 0 if throughput doesn't
+ * apply. */
+static void
+bench(const char *name, bench_func_t func, void *arg, int64_t items, int64_t bytes)
+{
+    for (int32_t i = 0; i < warmup; i ++) {
+	func(arg);
+    }
+
+    int64_t *times = malloc(runs * sizeof(int64_t));
+    for (int32_t i = 0; i < runs; i ++) {
+	int64_t start = now_ns();
+	func(arg);
+	times[i] = now_ns() - start;
+    }
+    qsort(times, runs, sizeof(int64_t), compare_ns);
+
+    int64_t median = runs % 2 ? times[runs / 2] : (times[runs / 2 - 1] + times[runs / 2]) / 2;
+    /* Nearest rank */
+    int64_t p99 = times[(runs * 99 + 99) / 100 - 1];
+    double mb_per_s = bytes > 0 ? bytes / (median / 1e9) / 1e6 : 0;
+
+    printf("%s\n    {\"name\": \"%s\", \"runs\": %d, \"min_ns\": %lld, \"median_ns\": %lld, \"p99_ns\": %lld, "
+	   "\"items\": %lld, \"median_ns_per_item\": %.1f",
+	   first_result ? "" : ",", name, runs, (long long) times[0], (long long) median, (long long) p99,
+	   (long long) items, (double) median / items);
+    if (bytes > 0) {
+	printf(", \"mb_per_s\": %.1f", mb_per_s);
+    }
+    printf("}");
+    first_result = 0;
+
+    fprintf(stderr, "%-32s median %10.3f ms  p99 %10.3f ms", name, median / 1e6, p99 / 1e6);
+    if (bytes > 0) {
+	fprintf(stderr, "  %8.1f MB/s", mb_per_s);
+    } else if (items > 1) {
+	fprintf(stderr, "  %8.1f us/item", median / 1e3 / items);
+    }
+    fprintf(stderr, "\n");
+    free(times);
+}
+
+typedef struct {
+    uint8_t bg_start;
+    uint8_t bg_end;
+    uint8_t table[65536];
+} build_case_t;
+
+static void
+run_build(void *arg)
+{
+    build_case_t *c = arg;
+    lcdg_build_table(c->table, 0, c->bg_start, c->bg_end);
+}
+
+#define BLEND_WIDTH 1920
+#define BLEND_ROWS 64
+
+typedef struct {
+    const uint8_t *table;
+    lcdg_compact_table_t *compact;
+    uint8_t *coverage;
+    uint8_t *dst;
+} blend_case_t;
+
+static void
+run_blend(void *arg)
+{
+    blend_case_t *c = arg;
+    for (int32_t y = 0; y < BLEND_ROWS; y ++) {
+	lcdg_blend_span_rgb(c->table, c->dst + y * BLEND_WIDTH * 3, c->coverage + y * BLEND_WIDTH * 3,
+			    BLEND_WIDTH, 0x20, 0x40, 0x60);
+    }
+}
+
+static void
+run_blend_compact(void *arg)
+{
+    blend_case_t *c = arg;
+    for (int32_t y = 0; y < BLEND_ROWS; y ++) {
+	lcdg_blend_span_rgb_compact(c->compact, c->dst + y * BLEND_WIDTH * 3, c->coverage + y * BLEND_WIDTH * 3,
+				    BLEND_WIDTH, 0x20, 0x40, 0x60);
+    }
+}
+
+typedef struct {
+    const char *font_name;
+    FT_Face face;
+    int32_t size_in_px;
+    int32_t count;
+} placement_case_t;
+
+static void
+run_placement(void *arg)
+{
+    placement_case_t *c = arg;
+    for (int32_t glyph_index = 1; glyph_index <= c->count; glyph_index ++) {
+	FT_Vector pos;
+	build_glyph(c->face, glyph_index);
+	optimize_placement_single(&c->face->glyph->outline, &pos);
+    }
+}
+
+static void
+run_face_scan(void *arg)
+{
+    placement_case_t *c = arg;
+    FT_Vector pos;
+    optimize_placement(c->face, c->font_name, c->size_in_px, 1, 0, &pos, 0);
+}
+
+typedef struct {
+    const char *font_name;
+    char size[16];
+} aligner_case_t;
+
+static void
+run_aligner(void *arg)
+{
+    aligner_case_t *c = arg;
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_addopen(&actions, 2, "/dev/null", O_WRONLY, 0);
+
+    char *argv[] = { ALIGNER, "-j", "1", (char *) c->font_name, c->size, "0", 0 };
+    extern char **environ;
+    pid_t pid;
+    if (posix_spawn(&pid, ALIGNER, &actions, 0, argv, environ) == 0) {
+	waitpid(pid, 0, 0);
+    }
+    posix_spawn_file_actions_destroy(&actions);
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *font_name = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "w:r:")) != -1) {
+	switch (opt) {
+	case 'w':
+	    warmup = atoi(optarg);
+	    break;
+	case 'r':
+	    runs = atoi(optarg);
+	    break;
+	default:
+	    fprintf(stderr, "Usage: %s [-w warmup] [-r runs] [font_file]\n", argv[0]);
+	    return 1;
+	}
+    }
+    if (runs < 1) {
+	runs = 1;
+    }
+    if (optind < argc) {
+	font_name = argv[optind];
+    }
+
+    printf("{\"benchmarks\": [");
+
+    static const uint8_t ranges[][2] = { { 0, 255 }, { 0, 63 }, { 192, 255 }, { 255, 255 } };
+    build_case_t *build = malloc(sizeof(build_case_t));
+    for (size_t i = 0; i < sizeof(ranges) / sizeof(ranges[0]); i ++) {
+	char name[64];
+	sprintf(name, "build_table/%d-%d", ranges[i][0], ranges[i][1]);
+	build->bg_start = ranges[i][0];
+	build->bg_end = ranges[i][1];
+	bench(name, run_build, build, 1, 0);
+
+	/* What the search did, in a separate run since the probes cost time */
+	lcdg_build_stats_t stats;
+	lcdg_build_table_stats(build->table, 0, build->bg_start, build->bg_end, 1, &stats);
+	fprintf(stderr, "    %.2f candidates per cell, at most %u, warm start optimal in %.1f%%,"
+		" init %.1f ms, search %.1f ms\n",
+		(double) stats.candidates / stats.cells, stats.max_candidates,
+		100.0 * stats.warm_start_hits / stats.cells,
+		stats.init_seconds * 1e3, stats.search_seconds * 1e3);
+    }
+    free(build);
+
+    blend_case_t blend;
+    blend.table = lcdg_get_default_table();
+    blend.compact = lcdg_compact_table_new(blend.table, 16, 0);
+    blend.coverage = malloc(BLEND_WIDTH * 3 * BLEND_ROWS);
+    blend.dst = malloc(BLEND_WIDTH * 3 * BLEND_ROWS);
+    srand(1);
+    for (int32_t i = 0; i < BLEND_WIDTH * 3 * BLEND_ROWS; i ++) {
+	blend.coverage[i] = rand();
+	blend.dst[i] = 0xf0;
+    }
+    bench("blend_span_rgb", run_blend, &blend, BLEND_ROWS, BLEND_WIDTH * 3 * BLEND_ROWS);
+    bench("blend_span_rgb_compact", run_blend_compact, &blend, BLEND_ROWS, BLEND_WIDTH * 3 * BLEND_ROWS);
+    lcdg_compact_table_free(blend.compact);
+    free(blend.coverage);
+    free(blend.dst);
+
+    if (font_name) {
+	static const int32_t sizes[] = { 8, 13, 20, 40 };
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i ++) {
+	    FT_Library library;
+	    placement_case_t placement = { font_name, 0, sizes[i], 0 };
+	    if (open_face(font_name, 0, sizes[i], &library, &placement.face)) {
+		break;
+	    }
+	    placement.count = placement.face->num_glyphs - 1 < 256 ? placement.face->num_glyphs - 1 : 256;
+
+	    char name[64];
+	    sprintf(name, "optimize_placement/%dpx", sizes[i]);
+	    bench(name, run_placement, &placement, placement.count, 0);
+	    sprintf(name, "face_scan/%dpx", sizes[i]);
+	    bench(name, run_face_scan, &placement, placement.face->num_glyphs, 0);
+
+	    FT_Done_Face(placement.face);
+	    FT_Done_FreeType(library);
+	}
+
+	if (access(ALIGNER, X_OK) == 0) {
+	    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i ++) {
+		aligner_case_t aligner = { font_name };
+		sprintf(aligner.size, "%d", sizes[i]);
+		char name[64];
+		sprintf(name, "aligner/%dpx", sizes[i]);
+		bench(name, run_aligner, &aligner, 1, 0);
+	    }
+	} else {
+	    fprintf(stderr, "%s not built, skipping the end-to-end cases\n", ALIGNER);
+	}
+    }
+
+    printf("\n]}\n");
+    return 0;
+}
@@ -0,0 +1,315 @@
+/*
+ * (c) 2013 Antti S. Lankila / BEL Solutions Oy
+ * See COPYING for the applicable Open Source license.
+ *
+ * Error of a table over every foreground, background and alpha. For each
+ * combination the blend with the corrected alpha in sRGB is compared to
+ * the correct blend in linear light, the same way full_error_map does for
+ * a single alpha, and the errors are summed up per alpha: maximum, mean
+ * and RMS, in 8-bit sRGB steps. A histogram of all errors follows, and
+ * the worst error over alpha of each foreground and background can be
+ * written out as a 256 x 256 map of native uint16_t, foreground major, in
+ * 16-bit sRGB units.
+ *
+ * Foregrounds are shared out between threads, and each (fg, alpha) row of
+ * backgrounds is computed with AVX2 where available.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <lcdglyph.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+/* Histogram buckets are a quarter of an 8-bit step wide, the last one
+ * catching everything past 63.75 steps */
+#define BUCKETS 256
+#define BUCKET_WIDTH (257 / 4)
+
+typedef struct {
+    uint32_t max[256];
+    uint64_t sum[256];
+    uint64_t sumsq[256];
+    uint64_t histogram[BUCKETS];
+} stats_t;
+
+typedef struct {
+    const uint8_t *table;
+    int32_t bg_start;
+    int32_t bg_end;
+    /* 16-bit linear of 8-bit sRGB, and 16-bit sRGB of 16-bit linear */
+    int32_t s2l[256];
+    int32_t l2s[65536];
+    uint16_t *heatmap;
+    int32_t next_fg;
+    stats_t stats;
+    pthread_mutex_t lock;
+} sweep_t;
+
+/* Absolute errors of the backgrounds bg_start .. bg_end for fg and alpha */
+typedef void (*errors_func_t)(const sweep_t *sweep, int32_t fg, int32_t alpha, uint32_t *errors);
+
+static float
+srgb_to_linear(float c)
+{
+    if (c <= 0.04045f) {
+        return c / 12.92f;
+    } else {
+        return powf((c + 0.055f) / 1.055f, 2.4f);
+    }
+}
+
+static float
+linear_to_srgb(float c)
+{
+    if (c <= 0.0031308f) {
+        return c * 12.92f;
+    } else {
+        return 1.055f * powf(c, 1.0f/2.4f) - 0.055f;
+    }
+}
+
+static void
+errors_scalar(const sweep_t *sweep, int32_t fg, int32_t alpha, uint32_t *errors)
+{
+    int32_t ac = sweep->table[fg << 8 | alpha];
+    for (int32_t bg = sweep->bg_start; bg <= sweep->bg_end; bg ++) {
+	int32_t correct = sweep->l2s[(sweep->s2l[fg] * alpha + sweep->s2l[bg] * (255 - alpha) + 128) / 255];
+	int32_t approximated = (fg * 0x101 * ac + bg * 0x101 * (255 - ac) + 128) / 255;
+	errors[bg - sweep->bg_start] = abs(approximated - correct);
+    }
+}
+
+#ifdef HAVE_X86
+/* x / 255 for x < 2^24: the float quotient is off by at most one */
+__attribute__((target("avx2")))
+static __m256i
+div255_avx2(__m256i x)
+{
+    __m256i q = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(x), _mm256_set1_ps(1.0f / 255.0f)));
+    __m256i r = _mm256_sub_epi32(x, _mm256_mullo_epi32(q, _mm256_set1_epi32(255)));
+    /* The compares give -1 where true */
+    q = _mm256_sub_epi32(q, _mm256_cmpgt_epi32(r, _mm256_set1_epi32(254)));
+    q = _mm256_add_epi32(q, _mm256_cmpgt_epi32(_mm256_setzero_si256(), r));
+    return q;
+}
+
+__attribute__((target("avx2")))
+static void
+errors_avx2(const sweep_t *sweep, int32_t fg, int32_t alpha, uint32_t *errors)
+{
+    int32_t ac = sweep->table[fg << 8 | alpha];
+    __m256i fg_part = _mm256_set1_epi32(sweep->s2l[fg] * alpha + 128);
+    __m256i bg_weight = _mm256_set1_epi32(255 - alpha);
+    __m256i approx_fg = _mm256_set1_epi32(fg * 0x101 * ac + 128);
+    __m256i approx_bg = _mm256_set1_epi32(0x101 * (255 - ac));
+    __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    int32_t bg = sweep->bg_start;
+    for (; bg + 8 <= sweep->bg_end + 1; bg += 8) {
+	__m256i bgs = _mm256_add_epi32(_mm256_set1_epi32(bg), lane);
+	__m256i bg_lin = _mm256_loadu_si256((const __m256i *) (sweep->s2l + bg));
+	__m256i lin = div255_avx2(_mm256_add_epi32(fg_part, _mm256_mullo_epi32(bg_lin, bg_weight)));
+	__m256i correct = _mm256_i32gather_epi32(sweep->l2s, lin, 4);
+	__m256i approximated = div255_avx2(_mm256_add_epi32(approx_fg, _mm256_mullo_epi32(bgs, approx_bg)));
+	__m256i error = _mm256_abs_epi32(_mm256_sub_epi32(approximated, correct));
+	_mm256_storeu_si256((__m256i *) (errors + bg - sweep->bg_start), error);
+    }
+    for (; bg <= sweep->bg_end; bg ++) {
+	int32_t correct = sweep->l2s[(sweep->s2l[fg] * alpha + sweep->s2l[bg] * (255 - alpha) + 128) / 255];
+	int32_t approximated = (fg * 0x101 * ac + bg * 0x101 * (255 - ac) + 128) / 255;
+	errors[bg - sweep->bg_start] = abs(approximated - correct);
+    }
+}
+#endif
+
+static errors_func_t
+select_errors()
+{
+#ifdef HAVE_X86
+    if (__builtin_cpu_supports("avx2")) {
+	return errors_avx2;
+    }
+#endif
+    return errors_scalar;
+}
+
+static void *
+sweep_worker(void *arg)
+{
+    sweep_t *sweep = arg;
+    errors_func_t errors_func = select_errors();
+    int32_t count = sweep->bg_end - sweep->bg_start + 1;
+
+    stats_t *stats = calloc(1, sizeof(stats_t));
+    uint32_t errors[256];
+    int32_t fg;
+    while ((fg = __sync_fetch_and_add(&sweep->next_fg, 1)) < 256) {
+	uint32_t worst[256] = { 0 };
+	for (int32_t alpha = 0; alpha < 256; alpha ++) {
+	    errors_func(sweep, fg, alpha, errors);
+	    uint32_t max = stats->max[alpha];
+	    uint64_t sum = 0, sumsq = 0;
+	    for (int32_t i = 0; i < count; i ++) {
+		uint32_t e = errors[i];
+		max = e > max ? e : max;
+		sum += e;
+		sumsq += (uint64_t) e * e;
+		worst[i] = e > worst[i] ? e : worst[i];
+		int32_t bucket = e / BUCKET_WIDTH;
+		stats->histogram[bucket < BUCKETS ? bucket : BUCKETS - 1] ++;
+	    }
+	    stats->max[alpha] = max;
+	    stats->sum[alpha] += sum;
+	    stats->sumsq[alpha] += sumsq;
+	}
+	if (sweep->heatmap != 0) {
+	    /* Each foreground row belongs to one thread */
+	    for (int32_t i = 0; i < count; i ++) {
+		sweep->heatmap[fg << 8 | (sweep->bg_start + i)] = worst[i];
+	    }
+	}
+    }
+
+    pthread_mutex_lock(&sweep->lock);
+    for (int32_t alpha = 0; alpha < 256; alpha ++) {
+	sweep->stats.max[alpha] = stats->max[alpha] > sweep->stats.max[alpha] ? stats->max[alpha] : sweep->stats.max[alpha];
+	sweep->stats.sum[alpha] += stats->sum[alpha];
+	sweep->stats.sumsq[alpha] += stats->sumsq[alpha];
+    }
+    for (int32_t b = 0; b < BUCKETS; b ++) {
+	sweep->stats.histogram[b] += stats->histogram[b];
+    }
+    pthread_mutex_unlock(&sweep->lock);
+    free(stats);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int32_t nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+    int32_t bg_start = 0, bg_end = 255;
+    const char *table_name = 0;
+    const char *heatmap_name = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "j:r:t:m:")) != -1) {
+	switch (opt) {
+	case 'j':
+	    nthreads = atoi(optarg);
+	    break;
+	case 'r':
+	    if (sscanf(optarg, "%d-%d", &bg_start, &bg_end) != 2
+		|| bg_start < 0 || bg_end > 255 || bg_start > bg_end) {
+		fprintf(stderr, "Bad background range %s\n", optarg);
+		return 1;
+	    }
+	    break;
+	case 't':
+	    table_name = optarg;
+	    break;
+	case 'm':
+	    heatmap_name = optarg;
+	    break;
+	default:
+	    fprintf(stderr, "Usage: %s [-j threads] [-r bg_start-bg_end] [-t table_file] [-m heatmap_file]\n", argv[0]);
+	    fprintf(stderr, "  -r  backgrounds to sweep and to build the table for (default: 0-255)\n");
+	    fprintf(stderr, "  -t  sweep the 65536 byte table in table_file instead of building one\n");
+	    fprintf(stderr, "  -m  write the worst error of each fg and bg to heatmap_file\n");
+	    return 1;
+	}
+    }
+
+    sweep_t *sweep = calloc(1, sizeof(sweep_t));
+    uint8_t *table = malloc(65536);
+    if (table_name != 0) {
+	FILE *file = fopen(table_name, "rb");
+	if (file == 0 || fread(table, 65536, 1, file) != 1) {
+	    fprintf(stderr, "Could not read a table from %s\n", table_name);
+	    return 1;
+	}
+	fclose(file);
+    } else {
+	lcdg_build_table_mt(table, 0, bg_start, bg_end, nthreads);
+    }
+
+    sweep->table = table;
+    sweep->bg_start = bg_start;
+    sweep->bg_end = bg_end;
+    for (int32_t c = 0; c < 256; c ++) {
+	sweep->s2l[c] = roundf(srgb_to_linear(c / 255.0f) * 65535.0f);
+    }
+    for (int32_t c = 0; c < 65536; c ++) {
+	sweep->l2s[c] = roundf(linear_to_srgb(c / 65535.0f) * 65535.0f);
+    }
+    if (heatmap_name != 0) {
+	sweep->heatmap = calloc(65536, sizeof(uint16_t));
+    }
+    pthread_mutex_init(&sweep->lock, 0);
+
+    if (nthreads < 1) {
+	nthreads = 1;
+    }
+    if (nthreads > 256) {
+	nthreads = 256;
+    }
+    pthread_t threads[256];
+    int32_t started = 0;
+    for (int32_t i = 1; i < nthreads; i ++) {
+	if (pthread_create(&threads[started], 0, sweep_worker, sweep) == 0) {
+	    started ++;
+	}
+    }
+    sweep_worker(sweep);
+    for (int32_t i = 0; i < started; i ++) {
+	pthread_join(threads[i], 0);
+    }
+    pthread_mutex_destroy(&sweep->lock);
+
+    /* Errors in 8-bit steps */
+    const stats_t *stats = &sweep->stats;
+    double count = 256.0 * (bg_end - bg_start + 1);
+    uint32_t max = 0;
+    uint64_t sum = 0, sumsq = 0;
+    printf("# alpha max mean rms\n");
+    for (int32_t alpha = 0; alpha < 256; alpha ++) {
+	printf("%d %f %f %f\n", alpha, stats->max[alpha] / 257.0,
+	       stats->sum[alpha] / count / 257.0, sqrt(stats->sumsq[alpha] / count) / 257.0);
+	max = stats->max[alpha] > max ? stats->max[alpha] : max;
+	sum += stats->sum[alpha];
+	sumsq += stats->sumsq[alpha];
+    }
+    printf("\n# all: max %f mean %f rms %f\n", max / 257.0, sum / count / 256.0 / 257.0,
+	   sqrt(sumsq / count / 256.0) / 257.0);
+
+    printf("\n# histogram: from to count\n");
+    for (int32_t b = 0; b < BUCKETS; b ++) {
+	if (stats->histogram[b] != 0) {
+	    printf("%f %f %llu\n", b * BUCKET_WIDTH / 257.0,
+		   b == BUCKETS - 1 ? INFINITY : (b + 1) * BUCKET_WIDTH / 257.0,
+		   (unsigned long long) stats->histogram[b]);
+	}
+    }
+
+    int32_t status = 0;
+    if (heatmap_name != 0) {
+	FILE *file = fopen(heatmap_name, "wb");
+	if (file == 0 || fwrite(sweep->heatmap, sizeof(uint16_t), 65536, file) != 65536 || fclose(file) != 0) {
+	    fprintf(stderr, "Could not write %s\n", heatmap_name);
+	    status = 1;
+	}
+	free(sweep->heatmap);
+    }
+    free(table);
+    free(sweep);
+    return status;
+}